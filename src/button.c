@@ -7,8 +7,8 @@
 * @brief    Button manipulations
 * @author   Ziga Miklosic
 * @email    ziga.miklosic@gmail.com
-* @date     08.11.2023
-* @version  V1.2.0
+* @date     18.10.2026
+* @version  V1.3.0
 */
 ////////////////////////////////////////////////////////////////////////////////
 /**
@@ -22,6 +22,8 @@
 ////////////////////////////////////////////////////////////////////////////////
 #include <stdint.h>
 #include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
 #include <assert.h>
 
 #include "button.h"
@@ -31,6 +33,11 @@
     #include "middleware/filter/src/filter.h"
 #endif
 
+#if ( 1 == BUTTON_CFG_TLM_EN )
+    #include "button_tlm.h"
+    #include "button_tlm_priv.h"
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////
 // Definitions
 ////////////////////////////////////////////////////////////////////////////////
@@ -62,515 +69,4062 @@ _Static_assert( 1 >= GPIO_VER_MINOR );
 #define BUTTON_HNDL_PERIOD_S                ( BUTTON_CFG_HNDL_PERIOD_S )
 
 /**
- *     Button handler frequency
+ *  Number of sampling rate buckets limit
+ */
+_Static_assert(( BUTTON_CFG_SAMPLE_DIV_NUM >= 1U ) && ( BUTTON_CFG_SAMPLE_DIV_NUM <= 0xFFFFU ));
+
+/**
+ *     Virtual input critical section
  *
- *     Unit: Hz
+ * @note    Left undefined by configuration, virtual input writes from
+ *          interrupt and another context race. Define them as empty in
+ *          "button_cfg.h" to confirm single writing context.
  */
-#define BUTTON_HNDL_FREQ_HZ                 ( 1.0f / BUTTON_HNDL_PERIOD_S )
+#if ( !defined( BUTTON_CFG_ENTER_CRITICAL ) || !defined( BUTTON_CFG_EXIT_CRITICAL ))
+    #warning "BUTTON: Critical section macros not defined, virtual input writes are not protected!"
+
+    #ifndef BUTTON_CFG_ENTER_CRITICAL
+        #define BUTTON_CFG_ENTER_CRITICAL() { ; }
+    #endif
+
+    #ifndef BUTTON_CFG_EXIT_CRITICAL
+        #define BUTTON_CFG_EXIT_CRITICAL()  { ; }
+    #endif
+#endif
+
+#if ( 1 == BUTTON_CFG_COMPACT_EN )
+
+    /**
+     *     Maximum button timing
+     *
+     *     Unit: handler ticks
+     *
+     * @note    Margin to 16-bit wrap-around covers time limit sweep over all
+     *          buttons.
+     */
+    #define BUTTON_TICK_MAX                 ( 0x7FFFU - (uint32_t) eBUTTON_NUM_OF )
+
+    /**
+     *  Number of buttons limit of compact profile
+     */
+    _Static_assert( eBUTTON_NUM_OF < 0x4000 );
+
+    /**
+     *  Callback group index limit
+     */
+    _Static_assert(( BUTTON_CFG_CB_GROUP_NUM >= 2U ) && ( BUTTON_CFG_CB_GROUP_NUM <= 256U ));
+
+    /**
+     *     Tick of last state change
+     */
+    typedef uint16_t button_tick_t;
+
+#else
+
+    /**
+     *     Maximum button timing
+     *
+     *     Unit: handler ticks
+     *
+     * @note    No more than 2^30 ticks in order to keep margin for tick counter
+     *          wrap-around.
+     */
+    #define BUTTON_TICK_MAX                 ( 0x40000000U )
+
+    /**
+     *     Tick of last state change
+     */
+    typedef uint32_t button_tick_t;
+
+#endif
 
 /**
  *     Limit press time
+ *
+ *     Unit: handler ticks
+ *
+ * @note    Time is limited to 1E6 sec, but no more than BUTTON_TICK_MAX.
  */
-#define BUTTON_LIM_TIME( time )             (( time > 1E6f ) ? ( 1E6f ) : ( time ))
+#define BUTTON_LIM_TICK                     ((( 1E6f / BUTTON_HNDL_PERIOD_S ) > (float32_t) BUTTON_TICK_MAX ) ? ( BUTTON_TICK_MAX ) : ((uint32_t)( 1E6f / BUTTON_HNDL_PERIOD_S )))
 
 /**
- *     Button live data
+ *     Elapsed ticks since last button state change, including current tick
  */
-typedef struct
-{
-    #if ( 1 == BUTTON_CFG_FILTER_EN )
-        p_filter_bool_t filt;       /**<Boolean filter */
-    #endif
-    pf_button_callback pressed;     /**<Button pressed callback */
-    pf_button_callback released;    /**<Button released callback */
-
-    struct
-    {
-        float32_t active;   /**<Button press-active time */
-        float32_t idle;     /**<Button idle time */
-    } time;
+#define BUTTON_ELAPSED_TICK( num )          ((uint32_t)((button_tick_t)( g_tick + 1U - g_button[num].edge )))
 
-    struct
-    {
-        button_state_t cur;     /**<Current button state */
-        button_state_t prev;    /**<Previous button state */
-    } state;
-    
-    bool enable;    /**<Button enable switch */
+/**
+ *     Button callbacks
+ */
+#if ( 1 == BUTTON_CFG_COMPACT_EN )
+    #define BUTTON_PRESSED_CB( num )        ( g_cb_group[ g_button[num].cb ].pressed )
+    #define BUTTON_RELEASED_CB( num )       ( g_cb_group[ g_button[num].cb ].released )
+#else
+    #define BUTTON_PRESSED_CB( num )        ( g_button[num].pressed )
+    #define BUTTON_RELEASED_CB( num )       ( g_button[num].released )
+#endif
 
-} button_data_t;
+/**
+ *     LPF settle time in number of filter time constants
+ *
+ * @note    After output of filter equals input, filter is still fed for
+ *          that long before button is skipped by handler. Residual of e^-17
+ *          is below single precision resolution (2^-24), thus skipped
+ *          samples do not shift later edges.
+ */
+#define BUTTON_LPF_SETTLE_TAU               ( 17.0f )
 
-////////////////////////////////////////////////////////////////////////////////
-// Variables
-////////////////////////////////////////////////////////////////////////////////
+/**
+ *     Number of 32-bit words of button bitmask
+ */
+#define BUTTON_WORD_NUM                     ((((uint32_t) eBUTTON_NUM_OF ) + 31U ) / 32U )
 
 /**
- *     Initialisation guard
+ *     Button bitmask word index and bit
  */
-static bool gb_is_init = false;
+#define BUTTON_WORD( num )                  (((uint32_t)( num )) >> 5U )
+#define BUTTON_BIT( num )                   ((uint32_t)( 1UL << (((uint32_t)( num )) & 0x1FU )))
 
 /**
- *     Pointer to configuration table
+ *     Count trailing zeros of non-zero word
  */
-static const button_cfg_t * gp_cfg_table = NULL;
+#if defined( __GNUC__ )
+    #define BUTTON_CTZ( x )                 ((uint32_t) __builtin_ctz( x ))
+#else
+    #define BUTTON_CTZ( x )                 ( button_ctz( x ))
+#endif
 
 /**
- *     Button data
+ *     Convert debounce time to number of handler ticks
+ *
+ * @note    Rounded up and limited to 16-bit counter range.
  */
-static button_data_t g_button[eBUTTON_NUM_OF] = { 0 };
+#define BUTTON_DEB_TIME_TO_TICK( time, period )     (( time >= ( 65535.0f * period )) ? ( 0xFFFFU ) : ((uint16_t)( time / period + 0.999f )))
 
-////////////////////////////////////////////////////////////////////////////////
-// Function Prototypes
-////////////////////////////////////////////////////////////////////////////////
-static button_status_t  button_check_drv_init   (void);
-static button_status_t  button_internal_init    (void);
-static button_state_t   button_get_low          (const button_num_t num);
-static button_state_t   button_filter_update    (const button_num_t num, const button_state_t state);
-static void             button_raise_callback   (const button_num_t num, const button_state_t state_cur, button_state_t state_prev);
-static void             button_manage_timings   (const button_num_t num, const button_state_t state);
+#if ( 1 == BUTTON_CFG_OVERSAMPLE_EN )
 
-////////////////////////////////////////////////////////////////////////////////
-// Functions
-////////////////////////////////////////////////////////////////////////////////
+    /**
+     *  Oversampling reads limit
+     *
+     * @note    Read counter is 4-bit wide.
+     */
+    _Static_assert(( BUTTON_CFG_OVERSAMPLE_NUM >= 2U ) && ( BUTTON_CFG_OVERSAMPLE_NUM <= 15U ));
 
-////////////////////////////////////////////////////////////////////////////////
-/**
-*       Check that low level drivers are initialised
-*
-* @return       status - Status of low level initialisation
-*/
-////////////////////////////////////////////////////////////////////////////////
-static button_status_t button_check_drv_init(void)
-{
-    button_status_t status             = eBUTTON_OK;
-    bool             gpio_drv_init     = false;
+    /**
+     *     Majority vote threshold - number of active reads
+     */
+    #define BUTTON_OVS_THRESHOLD            (( BUTTON_CFG_OVERSAMPLE_NUM / 2U ) + 1U )
 
-    // Get init flag
-    gpio_is_init( &gpio_drv_init );
+    /**
+     *     Width of bit-sliced read counter
+     */
+    #define BUTTON_OVS_CNT_BITS             ( 4U )
 
-    if ( false == gpio_drv_init )
+#endif
+
+#if ( 1 == BUTTON_CFG_DERIVED_EN )
+
+    /**
+     *  Derived input expression terms limit
+     *
+     * @note    Inverted terms are 8-bit mask.
+     */
+    _Static_assert(( BUTTON_CFG_DERIVED_TERM_MAX >= 1U ) && ( BUTTON_CFG_DERIVED_TERM_MAX <= 8U ));
+
+#endif
+
+#if ( 1 == BUTTON_CFG_REPEAT_EN )
+
+    /**
+     *     Auto-repeat
+     *
+     * @note    Repeats are kept in binary min-heap ordered by due tick, so
+     *          that handler checks only the earliest one.
+     */
+    typedef struct
     {
-        status = eBUTTON_ERROR_INIT;
-    }
+        uint32_t        due;        /**<Tick of next repeat */
+        uint16_t        period;     /**<Current repeat period. Unit: handler ticks */
+        uint16_t        cnt;        /**<Number of repeats */
+        button_num_t    num;        /**<Button enumeration number */
+    } button_repeat_t;
 
-    return status;
-}
+    /**
+     *     Check if repeat "a" is due before repeat "b"
+     *
+     * @note    Tick counter wrap-around safe.
+     */
+    #define BUTTON_REPEAT_BEFORE( a, b )    ((int32_t)(( a ).due - ( b ).due ) < 0 )
 
-////////////////////////////////////////////////////////////////////////////////
-/**
-*       Initialize internal button data
-*
-* @return   status - Status of initialization
-*/
-////////////////////////////////////////////////////////////////////////////////
-static button_status_t button_internal_init(void)
-{
-    button_status_t status = eBUTTON_OK;
+#endif
 
-    // Set up button
-    for ( button_num_t num = 0; num < eBUTTON_NUM_OF; num++ )
+#if ( 1 == BUTTON_CFG_SEQ_EN )
+
+    /**
+     *  Sequence automaton state limit
+     *
+     * @note    States are stored as 8-bit.
+     */
+    _Static_assert(( BUTTON_CFG_SEQ_STATE_NUM >= 2U ) && ( BUTTON_CFG_SEQ_STATE_NUM <= 256U ));
+
+    /**
+     *     No sequence completed at automaton state
+     */
+    #define BUTTON_SEQ_NONE                 ( 0xFFU )
+
+    /**
+     *     Press sequence
+     */
+    typedef struct
     {
-        // Init runtime vars
-        g_button[num].pressed       = NULL;
-        g_button[num].released      = NULL;
-        g_button[num].time.active   = 0.0f;
-        g_button[num].time.idle     = 0.0f;
-        g_button[num].state.cur     = eBUTTON_UNKNOWN;
-        g_button[num].state.prev    = eBUTTON_UNKNOWN;
+        button_num_t        btn[BUTTON_CFG_SEQ_LEN_MAX];    /**<Buttons to press */
+        uint32_t            len;                            /**<Sequence length, 0 if slot is free */
+        uint32_t            timeout;                        /**<Step timeout. Unit: handler ticks */
+        pf_button_callback  pf_done;                        /**<Completion callback */
+    } button_seq_t;
 
-        // Enable all buttons by default
-        g_button[num].enable = true;
+#endif
 
-        #if ( 1 == BUTTON_CFG_FILTER_EN )
+#if ( 1 == BUTTON_CFG_STREAM_EN )
 
-            g_button[num].filt = NULL;
+    /**
+     *  Stream debounce time limit
+     *
+     * @note    Debounce counter is at most 16-bit wide.
+     */
+    _Static_assert(( BUTTON_CFG_STREAM_DEB_NUM >= 1U ) && ( BUTTON_CFG_STREAM_DEB_NUM <= 0xFFFFU ));
 
-            // Filter enable?
-            if ( true == gp_cfg_table[num].lpf_en )
-            {
-                // Init filter
-                // NOTE: Comparator level set to 0.05 (5%/95%)---> 3*Tao is 95% for RC 1st order filter
-                if ( eFILTER_OK != filter_bool_init( &( g_button[num].filt ), gp_cfg_table[num].lpf_fc, BUTTON_HNDL_FREQ_HZ, 0.05f ))
-                {
-                    BUTTON_PRINT( "BUTTON: LPF initialisation error at button number %d!", num );
-                    BUTTON_ASSERT( 0 );
-                    status = eBUTTON_ERROR_INIT;
-                    break;
-                }
-            }
+    /**
+     *     Width of bit-sliced stream debounce counter
+     *
+     * @note    Just wide enough to hold BUTTON_CFG_STREAM_DEB_NUM, as each
+     *          bit adds one word operation per ingested sample.
+     */
+    #define BUTTON_STREAM_CNT_BITS                                      \
+        (   ( BUTTON_CFG_STREAM_DEB_NUM < 0x0002U ) ? ( 1U )  :         \
+            ( BUTTON_CFG_STREAM_DEB_NUM < 0x0004U ) ? ( 2U )  :         \
+            ( BUTTON_CFG_STREAM_DEB_NUM < 0x0008U ) ? ( 3U )  :         \
+            ( BUTTON_CFG_STREAM_DEB_NUM < 0x0010U ) ? ( 4U )  :         \
+            ( BUTTON_CFG_STREAM_DEB_NUM < 0x0020U ) ? ( 5U )  :         \
+            ( BUTTON_CFG_STREAM_DEB_NUM < 0x0040U ) ? ( 6U )  :         \
+            ( BUTTON_CFG_STREAM_DEB_NUM < 0x0080U ) ? ( 7U )  :         \
+            ( BUTTON_CFG_STREAM_DEB_NUM < 0x0100U ) ? ( 8U )  :         \
+            ( BUTTON_CFG_STREAM_DEB_NUM < 0x0200U ) ? ( 9U )  :         \
+            ( BUTTON_CFG_STREAM_DEB_NUM < 0x0400U ) ? ( 10U ) :         \
+            ( BUTTON_CFG_STREAM_DEB_NUM < 0x0800U ) ? ( 11U ) :         \
+            ( BUTTON_CFG_STREAM_DEB_NUM < 0x1000U ) ? ( 12U ) :         \
+            ( BUTTON_CFG_STREAM_DEB_NUM < 0x2000U ) ? ( 13U ) :         \
+            ( BUTTON_CFG_STREAM_DEB_NUM < 0x4000U ) ? ( 14U ) :         \
+            ( BUTTON_CFG_STREAM_DEB_NUM < 0x8000U ) ? ( 15U ) : ( 16U ))
 
-        #endif
-    }
+    /**
+     *     Number of bits of raw port word
+     */
+    #define BUTTON_STREAM_BITS              ( 32U )
 
-    return status;
-}
+#endif
 
-////////////////////////////////////////////////////////////////////////////////
 /**
-*       Get button low level
-*
-* @param[in]    num     - Button enumeration number
-* @return       status  - Status of operation
-*/
-////////////////////////////////////////////////////////////////////////////////
-static button_state_t button_get_low(const button_num_t num)
-{
-    button_state_t  state         = eBUTTON_UNKNOWN;
-    gpio_state_t    gpio_state    = eGPIO_UKNOWN;
+ *     Button sampling divider
+ *
+ * @note    Zero divider is treated as sampling at each handler call.
+ */
+#define BUTTON_SAMPLE_DIV( num )            (( gp_cfg_table[num].sample_div > 1U ) ? ( gp_cfg_table[num].sample_div ) : ( 1U ))
 
-    // Get gpio state
-    (void) gpio_get( gp_cfg_table[num].gpio_pin, &gpio_state );
+/**
+ *     Button sampling period
+ *
+ *     Unit: sec
+ */
+#define BUTTON_SAMPLE_PERIOD_S( num )       ( BUTTON_HNDL_PERIOD_S * (float32_t) BUTTON_SAMPLE_DIV( num ))
 
-    // Active high polarity
-    if ( eBUTTON_POL_ACTIVE_HIGH == gp_cfg_table[num].polarity )
+#if ( 1 == BUTTON_CFG_STATS_EN )
+
+    /**
+     *     Statistics record signature
+     */
+    #define BUTTON_STATS_SIGN               ( 0xB7705A75U )
+
+    /**
+     *     Statistics flush period
+     *
+     *     Unit: handler ticks
+     */
+    #define BUTTON_STATS_FLUSH_TICK         ((uint32_t)( BUTTON_CFG_STATS_FLUSH_PERIOD_S / BUTTON_HNDL_PERIOD_S ))
+
+    /**
+     *     Button statistics record
+     *
+     * @note    Record is stored to NVM as a whole.
+     */
+    typedef struct
     {
-        if ( eGPIO_HIGH == gpio_state )
-        {
-            state = eBUTTON_ON;
-        }
-        else if ( eGPIO_LOW == gpio_state )
-        {
-            state = eBUTTON_OFF;
-        }
-        else
-        {
-            state = eBUTTON_UNKNOWN;
-        }
-    }
+        uint32_t        sign;                   /**<Record signature */
+        button_stats_t  btn[eBUTTON_NUM_OF];    /**<Statistics of each button */
+        uint32_t        crc;                    /**<Record checksum */
+    } button_stats_rec_t;
 
-    // Active low polarity
-    else
+#endif
+
+#if ( 1 == BUTTON_CFG_COMPACT_EN )
+
+    /**
+     *     Button live data - compact profile
+     */
+    typedef struct
     {
-        if ( eGPIO_HIGH == gpio_state )
-        {
-            state = eBUTTON_OFF;
-        }
-        else if ( eGPIO_LOW == gpio_state )
-        {
-            state = eBUTTON_ON;
-        }
-        else
+        #if ( 1 == BUTTON_CFG_FILTER_EN )
+            p_filter_bool_t filt;   /**<Boolean filter */
+        #endif
+
+        struct
         {
-            state = eBUTTON_UNKNOWN;
-        }
-    }
+            uint16_t cnt;           /**<Debounce counter (DELAY), lock-out counter (EAGER) or settle counter (LPF) */
+            uint16_t press;         /**<Press debounce time (DELAY & EAGER) or filter settle time (LPF). Unit: samples */
+            uint16_t release;       /**<Release debounce time. Unit: samples */
+        } deb;
 
-    return state;
-}
+        button_tick_t edge;         /**<Tick of last state change. Active & idle time are measured from it */
+        uint8_t cb;                 /**<Callback group */
+        uint8_t state   : 2;        /**<Current button state */
+        bool    enable  : 1;        /**<Button enable switch */
 
-////////////////////////////////////////////////////////////////////////////////
-/**
-*       Update boolean filter
-*
-* @param[in]    num     - Button enumeration number
-* @param[in]    state   - Current state of button
-* @return       status  - Status of operation
-*/
-////////////////////////////////////////////////////////////////////////////////
-static button_state_t button_filter_update(const button_num_t num, const button_state_t state)
-{
-    button_state_t state_filt = eBUTTON_UNKNOWN;
+    } button_data_t;
 
-    #if ( 0 == BUTTON_CFG_FILTER_EN )
-        // Unused param
-        (void) num;
-    #endif
+    /**
+     *     Shared callback group
+     */
+    typedef struct
+    {
+        pf_button_callback pressed;     /**<Button pressed callback */
+        pf_button_callback released;    /**<Button released callback */
+        uint16_t ref;                   /**<Number of buttons referring to group. Group is free when zero */
+    } button_cb_group_t;
 
-    #if ( 1 == BUTTON_CFG_FILTER_EN )
-        bool in  = false;
-        bool out = false;
+#else
 
-        // Filter enabled
-        if ( true == gp_cfg_table[num].lpf_en )
+    /**
+     *     Button live data
+     */
+    typedef struct
+    {
+        #if ( 1 == BUTTON_CFG_FILTER_EN )
+            p_filter_bool_t filt;       /**<Boolean filter */
+        #endif
+        pf_button_callback pressed;     /**<Button pressed callback */
+        pf_button_callback released;    /**<Button released callback */
+        button_tick_t edge;             /**<Tick of last state change. Active & idle time are measured from it */
+        button_state_t state;           /**<Current button state */
+
+        struct
+        {
+            uint16_t cnt;           /**<Debounce counter (DELAY), lock-out counter (EAGER) or settle counter (LPF) */
+            uint16_t press;         /**<Press debounce time (DELAY & EAGER) or filter settle time (LPF). Unit: samples */
+            uint16_t release;       /**<Release debounce time. Unit: samples */
+        } deb;
+
+        bool enable;    /**<Button enable switch */
+
+    } button_data_t;
+
+#endif
+
+/**
+ *     Sampling rate bucket
+ *
+ * @note    Buttons inside bucket are sampled every "div" handler call. Bucket
+ *          buttons are spread evenly across "div" handler calls, so that
+ *          button at bucket position "k" is sampled when "phase == k % div".
+ */
+typedef struct
+{
+    uint16_t    div;        /**<Sampling divider */
+    uint16_t    phase;      /**<Current phase of bucket, counting from 0 to div-1 */
+    uint32_t    first;      /**<Index of first bucket button inside schedule table */
+    uint32_t    num_of;     /**<Number of buttons inside bucket */
+} button_bucket_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *     Initialisation guard
+ */
+static bool gb_is_init = false;
+
+/**
+ *     Pointer to configuration table
+ */
+static const button_cfg_t * gp_cfg_table = NULL;
+
+/**
+ *     Button data
+ */
+static button_data_t g_button[eBUTTON_NUM_OF] = { 0 };
+
+#if ( 1 == BUTTON_CFG_COMPACT_EN )
+
+    /**
+     *     Shared callback groups
+     *
+     * @note    Group 0 is reserved for buttons without callbacks, thus its
+     *          references are not counted.
+     */
+    static button_cb_group_t g_cb_group[BUTTON_CFG_CB_GROUP_NUM] = { 0 };
+
+#endif
+
+/**
+ *     Sampling rate buckets
+ */
+static button_bucket_t g_bucket[BUTTON_CFG_SAMPLE_DIV_NUM] = { 0 };
+static uint32_t        g_bucket_num = 0U;
+
+/**
+ *     Schedule table - button numbers sorted by sampling rate buckets
+ */
+static button_num_t g_sched[eBUTTON_NUM_OF] = { 0 };
+
+/**
+ *     Handler tick counter
+ *
+ * @note    Time base for button active & idle time.
+ */
+static uint32_t g_tick = 0U;
+
+/**
+ *     Index of button to check for time limit
+ */
+static uint32_t g_sweep = 0U;
+
+/**
+ *     Last raw samples of buttons
+ *
+ *  @note   Bit is set when button input is active.
+ */
+static uint32_t g_raw[BUTTON_WORD_NUM] = { 0 };
+
+/**
+ *     Buttons still settling inside debouncer
+ *
+ *  @note   Only buttons with changed raw sample or settling one are
+ *          processed by handler.
+ */
+static uint32_t g_settle[BUTTON_WORD_NUM] = { 0 };
+
+/**
+ *     Virtual inputs state
+ *
+ *  @note   Bit is set when input is active. Written by application, also
+ *          from interrupts.
+ */
+static volatile uint32_t g_virt[BUTTON_WORD_NUM] = { 0 };
+
+/**
+ *     Buttons with virtual input source
+ */
+static uint32_t g_virt_mask[BUTTON_WORD_NUM] = { 0 };
+
+#if ( 1 == BUTTON_CFG_OVERSAMPLE_EN )
+
+    /**
+     *     Buttons with oversampled input
+     */
+    static uint32_t g_ovs_mask[BUTTON_WORD_NUM] = { 0 };
+
+#endif
+
+#if ( 1 == BUTTON_CFG_DERIVED_EN )
+
+    /**
+     *     Derived input
+     *
+     * @note    Expression is compiled into bitmasks of terms, so that it is
+     *          evaluated word-wide over packed button states.
+     */
+    typedef struct
+    {
+        button_num_t    num;                    /**<Button number of derived input, eBUTTON_NUM_OF if slot is free */
+        uint32_t        mask[BUTTON_WORD_NUM];  /**<Term buttons */
+        uint32_t        inv[BUTTON_WORD_NUM];   /**<Inverted term buttons */
+    } button_derived_t;
+
+    /**
+     *     Derived inputs
+     */
+    static button_derived_t g_derived[BUTTON_CFG_DERIVED_NUM] = { 0 };
+
+    /**
+     *     Packed button states - active and known (not unknown) ones
+     */
+    static uint32_t g_on[BUTTON_WORD_NUM] = { 0 };
+    static uint32_t g_known[BUTTON_WORD_NUM] = { 0 };
+
+    /**
+     *     Buttons with changed state since last evaluation of derived inputs
+     */
+    static uint32_t g_changed[BUTTON_WORD_NUM] = { 0 };
+
+    /**
+     *     Buttons with derived input source
+     */
+    static uint32_t g_derived_mask[BUTTON_WORD_NUM] = { 0 };
+
+#endif
+
+#if ( 1 == BUTTON_CFG_STREAM_EN )
+
+    /**
+     *     Buttons with stream input source
+     */
+    static uint32_t g_stream_mask[BUTTON_WORD_NUM] = { 0 };
+
+    /**
+     *     Button number of each raw port word bit
+     *
+     * @note    eBUTTON_NUM_OF when bit is not used.
+     */
+    static button_num_t g_stream_btn[BUTTON_STREAM_BITS] = { 0 };
+
+    /**
+     *     Stream sample of last debounced edge of each port bit
+     */
+    static uint32_t g_stream_edge[BUTTON_STREAM_BITS] = { 0 };
+
+    /**
+     *     Port bits used by buttons, inverted (active low) port bits and
+     *     port bits waiting for first sample
+     */
+    static uint32_t g_stream_used = 0U;
+    static uint32_t g_stream_inv = 0U;
+    static uint32_t g_stream_new = 0U;
+
+    /**
+     *     Debounced state of port bits, bit set when input is active
+     */
+    static uint32_t g_stream_deb = 0U;
+
+    /**
+     *     Bit-sliced debounce counters of port bits
+     */
+    static uint32_t g_stream_cnt[BUTTON_STREAM_CNT_BITS] = { 0 };
+
+    /**
+     *     Stream sample counter
+     */
+    static uint32_t g_stream_smp = 0U;
+
+#endif
+
+#if ( 1 == BUTTON_CFG_REPEAT_EN )
+
+    /**
+     *     Auto-repeat heap
+     */
+    static button_repeat_t g_repeat[BUTTON_CFG_REPEAT_NUM] = { 0 };
+    static uint32_t        g_repeat_num = 0U;
+
+#endif
+
+#if ( 1 == BUTTON_CFG_SEQ_EN )
+
+    /**
+     *     Registered press sequences
+     */
+    static button_seq_t g_seq[BUTTON_CFG_SEQ_NUM] = { 0 };
+
+    /**
+     *     Sequence automaton transition table
+     *
+     * @note    Aho-Corasick automaton with all failure transitions resolved,
+     *          thus each press edge is single table lookup.
+     */
+    static uint8_t g_seq_dfa[BUTTON_CFG_SEQ_STATE_NUM][eBUTTON_NUM_OF] = { 0 };
+
+    /**
+     *     Sequence completed at state, next state with completed sequence
+     *     along failure links and step timeout of state
+     */
+    static uint8_t  g_seq_out[BUTTON_CFG_SEQ_STATE_NUM]     = { 0 };
+    static uint8_t  g_seq_dict[BUTTON_CFG_SEQ_STATE_NUM]    = { 0 };
+    static uint32_t g_seq_timeout[BUTTON_CFG_SEQ_STATE_NUM] = { 0 };
+
+    /**
+     *     Buttons used by any sequence
+     *
+     * @note    Presses of other buttons are ignored.
+     */
+    static uint32_t g_seq_used[BUTTON_WORD_NUM] = { 0 };
+
+    /**
+     *     Current automaton state
+     */
+    static uint32_t g_seq_state = 0U;
+
+    /**
+     *     Ticks of last presses of sequence buttons and position of last one
+     *
+     * @note    Used to check step timeouts of completed sequence.
+     */
+    static uint32_t g_seq_press[BUTTON_CFG_SEQ_LEN_MAX] = { 0 };
+    static uint32_t g_seq_pos = 0U;
+
+#endif
+
+#if ( 1 == BUTTON_CFG_TLM_EN )
+
+    /**
+     *     Buttons with unknown input state
+     *
+     * @note    Used for fault event reporting.
+     */
+    static uint32_t g_unk[BUTTON_WORD_NUM] = { 0 };
+
+#endif
+
+#if ( 1 == BUTTON_CFG_RUNTIME_CFG_EN )
+
+    /**
+     *     Double-buffered configuration tables
+     *
+     * @note    Handler uses active table, while new configuration is being
+     *          prepared inside back table. Tables are swapped by handler at
+     *          the beginning of its call.
+     */
+    static button_cfg_t g_cfg_buf[2][eBUTTON_NUM_OF] = { 0 };
+
+    /**
+     *     Index of active configuration table
+     */
+    static uint32_t g_cfg_idx = 0U;
+
+    /**
+     *     New configuration waiting to be applied by handler
+     */
+    static volatile bool gb_cfg_pending = false;
+
+#endif
+
+#if ( 1 == BUTTON_CFG_STATS_EN )
+
+    /**
+     *     Button statistics
+     */
+    static button_stats_rec_t g_stats = { 0 };
+
+    /**
+     *     Active time not yet accounted in whole seconds
+     *
+     *     Unit: sec
+     */
+    static float32_t g_stats_rem[eBUTTON_NUM_OF] = { 0 };
+
+    /**
+     *     Tick from which active time is not yet accounted
+     *
+     * @note    Kept apart from button timings, so that statistics are not
+     *          limited by timing width (compact profile) or restarted
+     *          by enable change.
+     */
+    static uint32_t g_stats_tick[eBUTTON_NUM_OF] = { 0 };
+
+    /**
+     *     Number of unstored statistics events
+     */
+    static uint32_t g_stats_dirty = 0U;
+
+    /**
+     *     Unstored active time
+     */
+    static bool gb_stats_time = false;
+
+    /**
+     *     Tick of last statistics store
+     */
+    static uint32_t g_stats_flush_tick = 0U;
+
+    /**
+     *     Last statistics store failed
+     */
+    static bool gb_stats_fail = false;
+
+#endif
+
+#if ( 1 == BUTTON_CFG_COMPACT_EN )
+
+    /**
+     *     RAM of optional features
+     *
+     *     Unit: bytes
+     */
+    #if ( 1 == BUTTON_CFG_OVERSAMPLE_EN )
+        #define BUTTON_RAM_OVS              ( sizeof( g_ovs_mask ))
+    #else
+        #define BUTTON_RAM_OVS              ( 0U )
+    #endif
+
+    #if ( 1 == BUTTON_CFG_DERIVED_EN )
+        #define BUTTON_RAM_DERIVED          ( sizeof( g_derived ) + sizeof( g_on ) + sizeof( g_known ) + sizeof( g_changed ) + sizeof( g_derived_mask ))
+    #else
+        #define BUTTON_RAM_DERIVED          ( 0U )
+    #endif
+
+    #if ( 1 == BUTTON_CFG_STREAM_EN )
+        #define BUTTON_RAM_STREAM           ( sizeof( g_stream_mask ) + sizeof( g_stream_btn ) + sizeof( g_stream_edge ) + sizeof( g_stream_cnt ))
+    #else
+        #define BUTTON_RAM_STREAM           ( 0U )
+    #endif
+
+    #if ( 1 == BUTTON_CFG_REPEAT_EN )
+        #define BUTTON_RAM_REPEAT           ( sizeof( g_repeat ))
+    #else
+        #define BUTTON_RAM_REPEAT           ( 0U )
+    #endif
+
+    #if ( 1 == BUTTON_CFG_SEQ_EN )
+        #define BUTTON_RAM_SEQ              ( sizeof( g_seq ) + sizeof( g_seq_dfa ) + sizeof( g_seq_out ) + sizeof( g_seq_dict ) + sizeof( g_seq_timeout ) + sizeof( g_seq_used ) + sizeof( g_seq_press ))
+    #else
+        #define BUTTON_RAM_SEQ              ( 0U )
+    #endif
+
+    #if ( 1 == BUTTON_CFG_TLM_EN )
+        #define BUTTON_RAM_TLM              ( sizeof( g_unk ))
+    #else
+        #define BUTTON_RAM_TLM              ( 0U )
+    #endif
+
+    #if ( 1 == BUTTON_CFG_RUNTIME_CFG_EN )
+        #define BUTTON_RAM_RUNTIME_CFG      ( sizeof( g_cfg_buf ))
+    #else
+        #define BUTTON_RAM_RUNTIME_CFG      ( 0U )
+    #endif
+
+    #if ( 1 == BUTTON_CFG_STATS_EN )
+        #define BUTTON_RAM_STATS            ( sizeof( g_stats ) + sizeof( g_stats_rem ) + sizeof( g_stats_tick ))
+    #else
+        #define BUTTON_RAM_STATS            ( 0U )
+    #endif
+
+    /**
+     *     RAM of module data
+     *
+     *     Unit: bytes
+     *
+     * @note    All arrays are counted. Scalars are left out.
+     */
+    #define BUTTON_RAM_SIZE                 (   sizeof( g_button ) + sizeof( g_cb_group ) + sizeof( g_bucket ) + sizeof( g_sched )                    \
+                                            +   sizeof( g_raw ) + sizeof( g_settle ) + sizeof( g_virt ) + sizeof( g_virt_mask )                     \
+                                            +   BUTTON_RAM_OVS + BUTTON_RAM_DERIVED + BUTTON_RAM_STREAM + BUTTON_RAM_REPEAT                         \
+                                            +   BUTTON_RAM_SEQ + BUTTON_RAM_TLM + BUTTON_RAM_RUNTIME_CFG + BUTTON_RAM_STATS )
+
+    /**
+     *  Module data RAM budget check
+     */
+    _Static_assert( BUTTON_RAM_SIZE <= BUTTON_CFG_RAM_BUDGET );
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+// Function Prototypes
+////////////////////////////////////////////////////////////////////////////////
+static button_status_t  button_check_drv_init   (void);
+static button_status_t  button_internal_init    (void);
+static void             button_internal_deinit  (void);
+static button_status_t  button_setup            (const button_num_t num);
+static void             button_release          (const button_num_t num);
+static button_status_t  button_sched_init       (void);
+static void             button_process          (const button_num_t num, const button_state_t state_in);
+static void             button_state_change     (const button_num_t num, const button_state_t state_cur);
+static void             button_sample           (uint32_t * const p_smp, uint32_t * const p_unk, uint32_t * const p_due);
+static uint32_t         button_gpio_skip        (const uint32_t w);
+static void             button_limit_time       (void);
+static button_state_t   button_get_low          (const button_num_t num);
+static button_state_t   button_filter_update    (const button_num_t num, const button_state_t state);
+static button_state_t   button_deb_delay        (const button_num_t num, const button_state_t state);
+static button_state_t   button_deb_eager        (const button_num_t num, const button_state_t state);
+static button_state_t   button_debounce         (const button_num_t num, const button_state_t state);
+static bool             button_deb_is_busy      (const button_num_t num, const button_state_t state);
+static void             button_raise_callback   (const button_num_t num, const button_state_t state_cur, button_state_t state_prev);
+static button_status_t  button_set_callback     (const button_num_t num, pf_button_callback pf_pressed, pf_button_callback pf_released);
+
+#if ( 1 == BUTTON_CFG_FILTER_EN )
+    static uint16_t     button_lpf_settle_time  (const button_num_t num, const float32_t fc);
+#endif
+
+#if !defined( __GNUC__ )
+    static uint32_t     button_ctz              (uint32_t x);
+#endif
+
+#if ( 1 == BUTTON_CFG_RUNTIME_CFG_EN )
+    static void         button_cfg_apply        (void);
+    static bool         button_cfg_is_equal     (const button_cfg_t * const p_a, const button_cfg_t * const p_b);
+#endif
+
+#if ( 1 == BUTTON_CFG_OVERSAMPLE_EN )
+    static void         button_oversample       (uint32_t * const p_smp, uint32_t * const p_unk, const uint32_t * const p_due);
+#endif
+
+#if ( 1 == BUTTON_CFG_STREAM_EN )
+    static void         button_stream_setup     (const button_num_t num);
+    static void         button_stream_release   (const button_num_t num);
+    static void         button_stream_edge      (uint32_t bits);
+#endif
+
+#if ( 1 == BUTTON_CFG_DERIVED_EN )
+    static void         button_derived_setup    (const button_num_t num);
+    static void         button_derived_release  (const button_num_t num);
+    static void         button_derived_hndl     (void);
+#endif
+
+#if ( 1 == BUTTON_CFG_REPEAT_EN )
+    static void         button_repeat_start     (const button_num_t num);
+    static void         button_repeat_stop      (const button_num_t num);
+    static void         button_repeat_sift_up   (uint32_t i);
+    static void         button_repeat_sift_down (uint32_t i);
+    static void         button_repeat_hndl      (void);
+#endif
+
+#if ( 1 == BUTTON_CFG_SEQ_EN )
+    static button_status_t  button_seq_build    (void);
+    static void             button_seq_edge     (const button_num_t num);
+    static bool             button_seq_in_time  (const uint32_t i);
+#endif
+
+#if ( 1 == BUTTON_CFG_TLM_EN )
+    static void         button_tlm_fault        (const uint32_t w, const uint32_t unk, const uint32_t due);
+#endif
+
+#if ( 1 == BUTTON_CFG_SELF_CHECK_EN )
+    static void         button_self_check       (const uint32_t * const p_smp, const uint32_t * const p_unk, const uint32_t * const p_due);
+#endif
+
+#if ( 1 == BUTTON_CFG_STATS_EN )
+    static void             button_stats_init   (void);
+    static void             button_stats_update (const button_num_t num, const button_state_t state_cur, const button_state_t state_prev);
+    static void             button_stats_accrue (const button_num_t num);
+    static void             button_stats_held   (void);
+    static void             button_stats_hndl   (void);
+    static button_status_t  button_stats_store  (void);
+    static uint32_t         button_stats_crc    (const button_stats_rec_t * const p_rec);
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Check that low level drivers are initialised
+*
+* @return       status - Status of low level initialisation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static button_status_t button_check_drv_init(void)
+{
+    button_status_t status             = eBUTTON_OK;
+    bool             gpio_drv_init     = false;
+
+    // Get init flag
+    gpio_is_init( &gpio_drv_init );
+
+    if ( false == gpio_drv_init )
+    {
+        status = eBUTTON_ERROR_INIT;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Initialize internal button data
+*
+* @return   status - Status of initialization
+*/
+////////////////////////////////////////////////////////////////////////////////
+static button_status_t button_internal_init(void)
+{
+    button_status_t status = eBUTTON_OK;
+
+    // Reset time base
+    g_tick  = 0U;
+    g_sweep = 0U;
+
+    // Virtual inputs released, no input reported unknown
+    for ( uint32_t w = 0U; w < BUTTON_WORD_NUM; w++ )
+    {
+        g_virt[w] = 0U;
+
+        #if ( 1 == BUTTON_CFG_TLM_EN )
+            g_unk[w] = 0U;
+        #endif
+    }
+
+    #if ( 1 == BUTTON_CFG_RUNTIME_CFG_EN )
+
+        // Take copy of configuration table, so that it can be changed later
+        memcpy( &g_cfg_buf[0], gp_cfg_table, sizeof( g_cfg_buf[0] ));
+        gp_cfg_table    = g_cfg_buf[0];
+        g_cfg_idx       = 0U;
+        gb_cfg_pending  = false;
+
+    #endif
+
+    #if ( 1 == BUTTON_CFG_STREAM_EN )
+
+        // No port bit used yet
+        for ( uint32_t b = 0U; b < BUTTON_STREAM_BITS; b++ )
+        {
+            g_stream_btn[b]     = eBUTTON_NUM_OF;
+            g_stream_edge[b]    = 0U;
+        }
+
+        g_stream_used   = 0U;
+        g_stream_inv    = 0U;
+        g_stream_new    = 0U;
+        g_stream_smp    = 0U;
+
+    #endif
+
+    #if ( 1 == BUTTON_CFG_REPEAT_EN )
+
+        // No repeating buttons
+        g_repeat_num = 0U;
+
+    #endif
+
+    #if ( 1 == BUTTON_CFG_SEQ_EN )
+
+        // Restart recognizer, registered sequences are kept
+        (void) button_seq_build();
+
+    #endif
+
+    #if ( 1 == BUTTON_CFG_DERIVED_EN )
+
+        // All derived input slots free
+        for ( uint32_t d = 0U; d < BUTTON_CFG_DERIVED_NUM; d++ )
+        {
+            g_derived[d].num = eBUTTON_NUM_OF;
+        }
+
+    #endif
+
+    #if ( 1 == BUTTON_CFG_COMPACT_EN )
+
+        // All callback groups free
+        for ( uint32_t g = 0U; g < BUTTON_CFG_CB_GROUP_NUM; g++ )
+        {
+            g_cb_group[g].pressed   = NULL;
+            g_cb_group[g].released  = NULL;
+            g_cb_group[g].ref       = 0U;
+        }
+
+    #endif
+
+    // Set up button
+    for ( button_num_t num = 0; num < eBUTTON_NUM_OF; num++ )
+    {
+        // Init runtime vars
+        #if ( 1 == BUTTON_CFG_COMPACT_EN )
+            g_button[num].cb = 0U;
+        #endif
+        (void) button_set_callback( num, NULL, NULL );
+
+        // Enable all buttons by default
+        g_button[num].enable = true;
+
+        #if ( 1 == BUTTON_CFG_FILTER_EN )
+            g_button[num].filt = NULL;
+        #endif
+    }
+
+    // Set up button debouncing
+    for ( button_num_t num = 0; num < eBUTTON_NUM_OF; num++ )
+    {
+        status = button_setup( num );
+
+        if ( eBUTTON_OK != status )
+        {
+            // Release already allocated resources
+            button_internal_deinit();
+            break;
+        }
+    }
+
+    // Sort buttons into sampling rate buckets
+    if ( eBUTTON_OK == status )
+    {
+        status = button_sched_init();
+
+        if ( eBUTTON_OK != status )
+        {
+            button_internal_deinit();
+        }
+    }
+
+    #if ( 1 == BUTTON_CFG_STATS_EN )
+
+        // Load statistics
+        button_stats_init();
+
+    #endif
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       De-initialize internal button data
+*
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void button_internal_deinit(void)
+{
+    for ( button_num_t num = 0; num < eBUTTON_NUM_OF; num++ )
+    {
+        button_release( num );
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Set up button state & debouncing based on its configuration
+*
+* @note     Callbacks and enable switch are kept as they are.
+*
+* @param[in]    num     - Button enumeration number
+* @return       status  - Status of initialization
+*/
+////////////////////////////////////////////////////////////////////////////////
+static button_status_t button_setup(const button_num_t num)
+{
+    button_status_t status = eBUTTON_OK;
+
+    // Sampling period of button
+    const float32_t period = BUTTON_SAMPLE_PERIOD_S( num );
+
+    #if ( 1 == BUTTON_CFG_REPEAT_EN )
+
+        // Button is not held anymore
+        button_repeat_stop( num );
+
+    #endif
+
+    // Restart button state
+    g_button[num].edge  = (button_tick_t) g_tick;
+    g_button[num].state = eBUTTON_UNKNOWN;
+
+    // First sample of button shall be processed
+    g_raw[ BUTTON_WORD( num ) ]     &= ~BUTTON_BIT( num );
+    g_settle[ BUTTON_WORD( num ) ]  |= BUTTON_BIT( num );
+
+    // Input source
+    if ( eBUTTON_SRC_VIRTUAL == gp_cfg_table[num].source )
+    {
+        g_virt_mask[ BUTTON_WORD( num ) ] |= BUTTON_BIT( num );
+    }
+    else
+    {
+        g_virt_mask[ BUTTON_WORD( num ) ] &= ~BUTTON_BIT( num );
+    }
+
+    #if ( 1 == BUTTON_CFG_OVERSAMPLE_EN )
+
+        // Oversampling of GPIO input
+        if  (   ( true == gp_cfg_table[num].oversample )
+            &&  ( eBUTTON_SRC_VIRTUAL != gp_cfg_table[num].source ))
+        {
+            g_ovs_mask[ BUTTON_WORD( num ) ] |= BUTTON_BIT( num );
+        }
+        else
+        {
+            g_ovs_mask[ BUTTON_WORD( num ) ] &= ~BUTTON_BIT( num );
+        }
+
+    #endif
+
+    #if ( 1 == BUTTON_CFG_STREAM_EN )
+
+        // Map raw port bit
+        button_stream_setup( num );
+
+    #endif
+
+    #if ( 1 == BUTTON_CFG_DERIVED_EN )
+
+        // Compile expression
+        button_derived_setup( num );
+
+    #endif
+
+    // Convert debounce times
+    g_button[num].deb.cnt       = 0U;
+    g_button[num].deb.press     = BUTTON_DEB_TIME_TO_TICK( gp_cfg_table[num].deb_press, period );
+    g_button[num].deb.release   = BUTTON_DEB_TIME_TO_TICK( gp_cfg_table[num].deb_release, period );
+
+    #if ( 1 == BUTTON_CFG_FILTER_EN )
+
+        // Filter enable?
+        if  (   ( eBUTTON_DEB_LPF == gp_cfg_table[num].deb_mode )
+            &&  ( true == gp_cfg_table[num].lpf_en ))
+        {
+            // Init filter
+            // NOTE: Comparator level set to 0.05 (5%/95%)---> 3*Tao is 95% for RC 1st order filter
+            if ( eFILTER_OK != filter_bool_init( &( g_button[num].filt ), gp_cfg_table[num].lpf_fc, ( 1.0f / period ), 0.05f ))
+            {
+                BUTTON_PRINT( "BUTTON: LPF initialisation error at button number %d!", num );
+                BUTTON_ASSERT( 0 );
+                status = eBUTTON_ERROR_INIT;
+            }
+
+            // Filter settle time
+            g_button[num].deb.press = button_lpf_settle_time( num, gp_cfg_table[num].lpf_fc );
+        }
+
+    #endif
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Release button debouncing resources
+*
+* @param[in]    num     - Button enumeration number
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void button_release(const button_num_t num)
+{
+    #if ( 1 == BUTTON_CFG_FILTER_EN )
+
+        if ( NULL != g_button[num].filt )
+        {
+            (void) filter_bool_deinit( &( g_button[num].filt ));
+            g_button[num].filt = NULL;
+        }
+
+    #else
+        // Unused param
+        (void) num;
+    #endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Initialize sampling schedule
+*
+* @note     Buttons with the same sampling divider are grouped into single
+*           bucket and placed next to each other inside schedule table, so
+*           that handler touches only buttons due at current call.
+*
+* @note     In case of more different sampling dividers than buckets
+*           (BUTTON_CFG_SAMPLE_DIV_NUM), remaining buttons are placed into
+*           last bucket and error is returned.
+*
+* @return       status - Status of initialization
+*/
+////////////////////////////////////////////////////////////////////////////////
+static button_status_t button_sched_init(void)
+{
+    button_status_t status = eBUTTON_OK;
+    uint32_t        fill[BUTTON_CFG_SAMPLE_DIV_NUM] = { 0 };
+
+    g_bucket_num = 0U;
+
+    // Find all different sampling dividers
+    for ( button_num_t num = 0; num < eBUTTON_NUM_OF; num++ )
+    {
+        const uint16_t div = BUTTON_SAMPLE_DIV( num );
+        uint32_t b = 0U;
+
+        for ( b = 0U; b < g_bucket_num; b++ )
+        {
+            if ( div == g_bucket[b].div )
+            {
+                break;
+            }
+        }
+
+        // New bucket
+        if ( b == g_bucket_num )
+        {
+            if ( g_bucket_num < BUTTON_CFG_SAMPLE_DIV_NUM )
+            {
+                g_bucket[b].div     = div;
+                g_bucket[b].phase   = 0U;
+                g_bucket[b].num_of  = 0U;
+                g_bucket_num++;
+            }
+
+            // Out of buckets - sample at rate of last bucket
+            else
+            {
+                b = g_bucket_num - 1U;
+                status = eBUTTON_ERROR;
+            }
+        }
+
+        g_bucket[b].num_of++;
+    }
+
+    // Place buckets one after another
+    for ( uint32_t b = 0U; b < g_bucket_num; b++ )
+    {
+        g_bucket[b].first = ( b > 0U ) ? ( g_bucket[b-1U].first + g_bucket[b-1U].num_of ) : 0U;
+    }
+
+    // Fill schedule table
+    for ( button_num_t num = 0; num < eBUTTON_NUM_OF; num++ )
+    {
+        uint32_t b = 0U;
+
+        for ( b = 0U; b < ( g_bucket_num - 1U ); b++ )
+        {
+            if ( BUTTON_SAMPLE_DIV( num ) == g_bucket[b].div )
+            {
+                break;
+            }
+        }
+
+        g_sched[ g_bucket[b].first + fill[b] ] = num;
+        fill[b]++;
+    }
+
+    if ( eBUTTON_OK != status )
+    {
+        BUTTON_PRINT( "BUTTON: Too many different sampling dividers! Increase BUTTON_CFG_SAMPLE_DIV_NUM!" );
+        BUTTON_ASSERT( 0 );
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get button low level
+*
+* @param[in]    num     - Button enumeration number
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static button_state_t button_get_low(const button_num_t num)
+{
+    button_state_t  state         = eBUTTON_UNKNOWN;
+    gpio_state_t    gpio_state    = eGPIO_UKNOWN;
+
+    // Get gpio state
+    (void) gpio_get( gp_cfg_table[num].gpio_pin, &gpio_state );
+
+    // Active high polarity
+    if ( eBUTTON_POL_ACTIVE_HIGH == gp_cfg_table[num].polarity )
+    {
+        if ( eGPIO_HIGH == gpio_state )
+        {
+            state = eBUTTON_ON;
+        }
+        else if ( eGPIO_LOW == gpio_state )
+        {
+            state = eBUTTON_OFF;
+        }
+        else
+        {
+            state = eBUTTON_UNKNOWN;
+        }
+    }
+
+    // Active low polarity
+    else
+    {
+        if ( eGPIO_HIGH == gpio_state )
+        {
+            state = eBUTTON_OFF;
+        }
+        else if ( eGPIO_LOW == gpio_state )
+        {
+            state = eBUTTON_ON;
+        }
+        else
+        {
+            state = eBUTTON_UNKNOWN;
+        }
+    }
+
+    return state;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Update boolean filter
+*
+* @param[in]    num     - Button enumeration number
+* @param[in]    state   - Current state of button
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static button_state_t button_filter_update(const button_num_t num, const button_state_t state)
+{
+    button_state_t state_filt = eBUTTON_UNKNOWN;
+
+    #if ( 0 == BUTTON_CFG_FILTER_EN )
+        // Unused param
+        (void) num;
+    #endif
+
+    #if ( 1 == BUTTON_CFG_FILTER_EN )
+        bool in  = false;
+        bool out = false;
+
+        // Filter enabled
+        if ( NULL != g_button[num].filt )
+        {
+            // Convert state
+            if ( eBUTTON_ON == state )
+            {
+                in = true;
+            }
+            else
+            {
+                in = false;
+            }
+
+            // Update filter
+            (void) filter_bool_hndl( g_button[num].filt, in, &out );
+
+            // Convert state
+            if ( true == out )
+            {
+                state_filt = eBUTTON_ON;
+            }
+            else
+            {
+                state_filt = eBUTTON_OFF;
+            }
+
+            // Count samples since filter output reached input
+            if ( out != in )
+            {
+                g_button[num].deb.cnt = 0U;
+            }
+            else if ( g_button[num].deb.cnt < g_button[num].deb.press )
+            {
+                g_button[num].deb.cnt++;
+            }
+            else
+            {
+                // No actions...
+            }
+        }
+
+        // Filter disabled
+        else
+    #endif
+        {
+            state_filt = state;
+        }
+
+    return state_filt;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Delayed (integrating) debounce
+*
+* @note     State is changed only after input differs from current state for
+*           press (OFF->ON) or release (ON->OFF) number of consecutive ticks.
+*
+* @note     Unknown input is propagated as unknown state. First known
+*           sample afterwards is taken as is.
+*
+* @param[in]    num     - Button enumeration number
+* @param[in]    state   - Current state of button
+* @return       state   - Debounced state of button
+*/
+////////////////////////////////////////////////////////////////////////////////
+static button_state_t button_deb_delay(const button_num_t num, const button_state_t state)
+{
+    const button_state_t    state_in    = state;
+    button_state_t          state_deb   = g_button[num].state;
+
+    // Input unknown or first sample after init
+    if  (   ( eBUTTON_UNKNOWN == state_in )
+        ||  ( eBUTTON_UNKNOWN == state_deb ))
+    {
+        state_deb = state_in;
+        g_button[num].deb.cnt = 0U;
+    }
+
+    // Input equals debounced state
+    else if ( state_in == state_deb )
+    {
+        g_button[num].deb.cnt = 0U;
+    }
+
+    // Input differs for long enough?
+    else
+    {
+        const uint16_t time = ( eBUTTON_ON == state_in ) ? g_button[num].deb.press : g_button[num].deb.release;
+
+        if ( g_button[num].deb.cnt < 0xFFFFU )
+        {
+            g_button[num].deb.cnt++;
+        }
+
+        if ( g_button[num].deb.cnt >= time )
+        {
+            state_deb = state_in;
+            g_button[num].deb.cnt = 0U;
+        }
+    }
+
+    return state_deb;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Eager debounce
+*
+* @note     Change of state is reported on very first sample of new state,
+*           afterwards input is ignored for press (OFF->ON) or release (ON->OFF)
+*           number of ticks.
+*
+* @note     Unknown input is propagated as unknown state and aborts lock-out.
+*
+* @param[in]    num     - Button enumeration number
+* @param[in]    state   - Current state of button
+* @return       state   - Debounced state of button
+*/
+////////////////////////////////////////////////////////////////////////////////
+static button_state_t button_deb_eager(const button_num_t num, const button_state_t state)
+{
+    const button_state_t    state_in    = state;
+    button_state_t          state_deb   = g_button[num].state;
+
+    // Input unknown
+    if ( eBUTTON_UNKNOWN == state_in )
+    {
+        state_deb = state_in;
+        g_button[num].deb.cnt = 0U;
+    }
+
+    // Lock-out in progress
+    else if ( g_button[num].deb.cnt > 0U )
+    {
+        g_button[num].deb.cnt--;
+    }
+
+    // First sample after init
+    else if ( eBUTTON_UNKNOWN == state_deb )
+    {
+        state_deb = state_in;
+    }
+
+    // Edge detected - report it and start lock-out
+    else if ( state_in != state_deb )
+    {
+        state_deb = state_in;
+        g_button[num].deb.cnt = ( eBUTTON_ON == state_in ) ? g_button[num].deb.press : g_button[num].deb.release;
+    }
+
+    else
+    {
+        // No actions...
+    }
+
+    return state_deb;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Debounce button input based on configured debounce mode
+*
+* @param[in]    num     - Button enumeration number
+* @param[in]    state   - Current state of button
+* @return       state   - Debounced state of button
+*/
+////////////////////////////////////////////////////////////////////////////////
+static button_state_t button_debounce(const button_num_t num, const button_state_t state)
+{
+    button_state_t state_deb = eBUTTON_UNKNOWN;
+
+    switch( gp_cfg_table[num].deb_mode )
+    {
+        case eBUTTON_DEB_DELAY:
+            state_deb = button_deb_delay( num, state );
+            break;
+
+        case eBUTTON_DEB_EAGER:
+            state_deb = button_deb_eager( num, state );
+            break;
+
+        case eBUTTON_DEB_LPF:
+        default:
+            state_deb = button_filter_update( num, state );
+            break;
+    }
+
+    return state_deb;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Manage button callbacks
+*
+* @note     If button is disabled, callbacks will not be triggered!
+*
+* @param[in]    num         - Button enumeration number
+* @param[in]    state_cur   - Current state of button
+* @param[in]    state_prev  - Previous state of button
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void button_raise_callback(const button_num_t num, const button_state_t state_cur, button_state_t state_prev)
+{
+    // Is button enabled
+    if ( true == g_button[num].enable )
+    {
+        if     (    ( NULL != BUTTON_PRESSED_CB( num ))
+            &&     ( eBUTTON_ON  == state_cur )
+            &&     ( eBUTTON_OFF == state_prev ))
+        {
+            BUTTON_PRESSED_CB( num )();
+        }
+
+        if     (    ( NULL != BUTTON_RELEASED_CB( num ))
+            &&     ( eBUTTON_OFF == state_cur )
+            &&     ( eBUTTON_ON  == state_prev ))
+        {
+            BUTTON_RELEASED_CB( num )();
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Set button callbacks
+*
+* @note     In compact profile button refers to shared callback group with
+*           the same pair of callbacks. New group is taken if there is none.
+*           Group is released when its last button refers to other group.
+*
+* @param[in]    num         - Button enumeration number
+* @param[in]    pf_pressed  - Pointer to pressed callback function
+* @param[in]    pf_released - Pointer to release callback function
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+static button_status_t button_set_callback(const button_num_t num, pf_button_callback pf_pressed, pf_button_callback pf_released)
+{
+    button_status_t status = eBUTTON_OK;
+
+    #if ( 1 == BUTTON_CFG_COMPACT_EN )
+
+        const uint32_t  prev    = g_button[num].cb;
+        uint32_t        g       = 0U;
+        uint32_t        slot    = BUTTON_CFG_CB_GROUP_NUM;
+
+        // Find group with the same callbacks and first free one
+        for ( g = 0U; g < BUTTON_CFG_CB_GROUP_NUM; g++ )
+        {
+            if  (   ( pf_pressed == g_cb_group[g].pressed )
+                &&  ( pf_released == g_cb_group[g].released ))
+            {
+                break;
+            }
+            else if (   ( g > 0U )
+                    &&  ( 0U == g_cb_group[g].ref )
+                    &&  ( BUTTON_CFG_CB_GROUP_NUM == slot ))
+            {
+                slot = g;
+            }
+            else
+            {
+                // No actions...
+            }
+        }
+
+        // Group of button can be changed in place, if button is its only user
+        if  (   ( BUTTON_CFG_CB_GROUP_NUM == slot )
+            &&  ( prev > 0U )
+            &&  ( 1U == g_cb_group[prev].ref ))
+        {
+            slot = prev;
+        }
+
+        // Take free group
+        if  (   ( g >= BUTTON_CFG_CB_GROUP_NUM )
+            &&  ( slot < BUTTON_CFG_CB_GROUP_NUM ))
+        {
+            g = slot;
+            g_cb_group[g].pressed   = pf_pressed;
+            g_cb_group[g].released  = pf_released;
+        }
+
+        if ( g < BUTTON_CFG_CB_GROUP_NUM )
+        {
+            if ( g != prev )
+            {
+                // Release previous group
+                if ( prev > 0U )
+                {
+                    g_cb_group[prev].ref--;
+
+                    if ( 0U == g_cb_group[prev].ref )
+                    {
+                        g_cb_group[prev].pressed    = NULL;
+                        g_cb_group[prev].released   = NULL;
+                    }
+                }
+
+                if ( g > 0U )
+                {
+                    g_cb_group[g].ref++;
+                }
+
+                g_button[num].cb = (uint8_t) g;
+            }
+        }
+        else
+        {
+            BUTTON_PRINT( "BUTTON: No free callback group for button number %d!", num );
+            status = eBUTTON_ERROR;
+        }
+
+    #else
+
+        g_button[num].pressed   = pf_pressed;
+        g_button[num].released  = pf_released;
+
+    #endif
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Check if button debouncer still needs samples
+*
+* @note     Button with idle debouncer and unchanged input is skipped by
+*           handler.
+*
+* @note     Button with LPF is processed until filter output equals input
+*           for BUTTON_LPF_SETTLE_TAU time constants, as filter internal
+*           state keeps changing after output has switched.
+*
+* @param[in]    num     - Button enumeration number
+* @param[in]    state   - Current (raw) state of button
+* @return       busy    - True if debouncer is settling
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool button_deb_is_busy(const button_num_t num, const button_state_t state)
+{
+    bool busy = false;
+
+    // Unknown input or output
+    if  (   ( eBUTTON_UNKNOWN == state )
+        ||  ( eBUTTON_UNKNOWN == g_button[num].state ))
+    {
+        busy = true;
+    }
+
+    // Delay or lock-out in progress
+    else if ( eBUTTON_DEB_LPF != gp_cfg_table[num].deb_mode )
+    {
+        busy = (( g_button[num].deb.cnt > 0U ) || ( state != g_button[num].state ));
+    }
+
+    // Filter settling
+    else
+    {
+        #if ( 1 == BUTTON_CFG_FILTER_EN )
+            busy = (( NULL != g_button[num].filt ) && ( g_button[num].deb.cnt < g_button[num].deb.press ));
+        #endif
+    }
+
+    return busy;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Process single button
+*
+* @param[in]    num         - Button enumeration number
+* @param[in]    state_in    - Current (raw) state of button
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void button_process(const button_num_t num, const button_state_t state_in)
+{
+    // Apply debouncing
+    const button_state_t state_cur = button_debounce( num, state_in );
+
+    // State changed
+    if ( state_cur != g_button[num].state )
+    {
+        button_state_change( num, state_cur );
+    }
+
+    // Keep processing button until debouncer settles
+    if ( true == button_deb_is_busy( num, state_in ))
+    {
+        g_settle[ BUTTON_WORD( num ) ] |= BUTTON_BIT( num );
+    }
+    else
+    {
+        g_settle[ BUTTON_WORD( num ) ] &= ~BUTTON_BIT( num );
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Change debounced button state
+*
+* @note     Restarts timings and reports change via callbacks, statistics
+*           and telemetry.
+*
+* @param[in]    num         - Button enumeration number
+* @param[in]    state_cur   - New debounced state of button
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void button_state_change(const button_num_t num, const button_state_t state_cur)
+{
+    const button_state_t state_prev = g_button[num].state;
+
+    #if ( 1 == BUTTON_CFG_DERIVED_EN )
+
+        // Update packed state
+        if ( eBUTTON_ON == state_cur )
+        {
+            g_on[ BUTTON_WORD( num ) ] |= BUTTON_BIT( num );
+        }
+        else
+        {
+            g_on[ BUTTON_WORD( num ) ] &= ~BUTTON_BIT( num );
+        }
+
+        if ( eBUTTON_UNKNOWN != state_cur )
+        {
+            g_known[ BUTTON_WORD( num ) ] |= BUTTON_BIT( num );
+        }
+        else
+        {
+            g_known[ BUTTON_WORD( num ) ] &= ~BUTTON_BIT( num );
+        }
+
+        g_changed[ BUTTON_WORD( num ) ] |= BUTTON_BIT( num );
+
+    #endif
+
+    #if ( 1 == BUTTON_CFG_STATS_EN )
+
+        // Account press
+        button_stats_update( num, state_cur, state_prev );
+
+    #endif
+
+    g_button[num].state = state_cur;
+
+    // Restart timings
+    g_button[num].edge = (button_tick_t) g_tick;
+
+    // Manage callbacks
+    button_raise_callback( num, state_cur, state_prev );
+
+    #if ( 1 == BUTTON_CFG_SEQ_EN )
+
+        // Advance press sequence recognizer
+        if  (   ( eBUTTON_ON  == state_cur )
+            &&  ( eBUTTON_OFF == state_prev )
+            &&  ( true == g_button[num].enable ))
+        {
+            button_seq_edge( num );
+        }
+
+    #endif
+
+    #if ( 1 == BUTTON_CFG_REPEAT_EN )
+
+        // Auto-repeat while held
+        if  (   ( eBUTTON_ON  == state_cur )
+            &&  ( eBUTTON_OFF == state_prev ))
+        {
+            button_repeat_start( num );
+        }
+        else if ( eBUTTON_ON == state_prev )
+        {
+            button_repeat_stop( num );
+        }
+        else
+        {
+            // No actions...
+        }
+
+    #endif
+
+    #if ( 1 == BUTTON_CFG_TLM_EN )
+
+        // Report edge
+        if ( true == g_button[num].enable )
+        {
+            if  (   ( eBUTTON_ON  == state_cur )
+                &&  ( eBUTTON_OFF == state_prev ))
+            {
+                button_tlm_put( eBUTTON_TLM_EVT_PRESS, (uint32_t) num, g_tick, 0U );
+            }
+            else if (   ( eBUTTON_OFF == state_cur )
+                    &&  ( eBUTTON_ON  == state_prev ))
+            {
+                button_tlm_put( eBUTTON_TLM_EVT_RELEASE, (uint32_t) num, g_tick, 0U );
+            }
+            else
+            {
+                // No actions...
+            }
+        }
+
+    #endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Sample buttons due at current handler call
+*
+* @note     Virtual inputs are merged into samples word-wide, thus they go
+*           through the same debouncing, timings and callbacks as GPIO.
+*
+* @param[out]   p_smp   - Bitmask of active inputs
+* @param[out]   p_unk   - Bitmask of inputs with unknown state
+* @param[out]   p_due   - Bitmask of sampled buttons
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void button_sample(uint32_t * const p_smp, uint32_t * const p_unk, uint32_t * const p_due)
+{
+    // For each sampling rate bucket
+    for ( uint32_t b = 0U; b < g_bucket_num; b++ )
+    {
+        button_bucket_t * const p_bucket = &g_bucket[b];
+
+        // Sample only buttons due at current phase
+        for ( uint32_t k = p_bucket->phase; k < p_bucket->num_of; k += p_bucket->div )
+        {
+            const button_num_t num = g_sched[ p_bucket->first + k ];
+            button_state_t state = eBUTTON_OFF;
+
+            p_due[ BUTTON_WORD( num ) ] |= BUTTON_BIT( num );
+
+            // Only plain GPIO inputs are read here
+            if ( 0U == ( button_gpio_skip( BUTTON_WORD( num )) & BUTTON_BIT( num )))
+            {
+                state = button_get_low( num );
+            }
+
+            if ( eBUTTON_ON == state )
+            {
+                p_smp[ BUTTON_WORD( num ) ] |= BUTTON_BIT( num );
+            }
+            else if ( eBUTTON_UNKNOWN == state )
+            {
+                p_unk[ BUTTON_WORD( num ) ] |= BUTTON_BIT( num );
+            }
+            else
+            {
+                // No actions...
+            }
+        }
+
+        // Advance phase
+        p_bucket->phase++;
+
+        if ( p_bucket->phase >= p_bucket->div )
+        {
+            p_bucket->phase = 0U;
+        }
+    }
+
+    // Merge virtual inputs
+    for ( uint32_t w = 0U; w < BUTTON_WORD_NUM; w++ )
+    {
+        p_smp[w] |= ( g_virt[w] & g_virt_mask[w] & p_due[w] );
+    }
+
+    #if ( 1 == BUTTON_CFG_OVERSAMPLE_EN )
+
+        // Merge majority vote of oversampled inputs
+        button_oversample( p_smp, p_unk, p_due );
+
+    #endif
+
+    #if ( 1 == BUTTON_CFG_STREAM_EN )
+
+        // Stream inputs are debounced by ingest
+        for ( uint32_t w = 0U; w < BUTTON_WORD_NUM; w++ )
+        {
+            p_due[w] &= ~g_stream_mask[w];
+        }
+
+    #endif
+
+    #if ( 1 == BUTTON_CFG_DERIVED_EN )
+
+        // Derived inputs are evaluated from other buttons
+        for ( uint32_t w = 0U; w < BUTTON_WORD_NUM; w++ )
+        {
+            p_due[w] &= ~g_derived_mask[w];
+        }
+
+    #endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get buttons not read by GPIO sampling
+*
+* @param[in]    w       - Bitmask word index
+* @return       mask    - Bitmask word of virtual, oversampled, stream and derived inputs
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t button_gpio_skip(const uint32_t w)
+{
+    uint32_t mask = g_virt_mask[w];
+
+    #if ( 1 == BUTTON_CFG_OVERSAMPLE_EN )
+        mask |= g_ovs_mask[w];
+    #endif
+
+    #if ( 1 == BUTTON_CFG_STREAM_EN )
+        mask |= g_stream_mask[w];
+    #endif
+
+    #if ( 1 == BUTTON_CFG_DERIVED_EN )
+        mask |= g_derived_mask[w];
+    #endif
+
+    return mask;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Limit button timings
+*
+* @note     Single button is checked per handler call, thus cost is constant.
+*           Time of last state change is kept within time limit, so that tick
+*           counter wrap-around has no effect on button timings.
+*
+* @note     Active time of held button is accounted to statistics here as
+*           well, so that long press is stored before button is released.
+*
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void button_limit_time(void)
+{
+    if ( BUTTON_ELAPSED_TICK( g_sweep ) > BUTTON_LIM_TICK )
+    {
+        g_button[g_sweep].edge = (button_tick_t)( g_tick + 1U - BUTTON_LIM_TICK );
+    }
+
+    #if ( 1 == BUTTON_CFG_STATS_EN )
+
+        // Account active time of held button
+        if ( eBUTTON_ON == g_button[g_sweep].state )
+        {
+            button_stats_accrue( g_sweep );
+        }
+
+    #endif
+
+    g_sweep++;
+
+    if ( g_sweep >= (uint32_t) eBUTTON_NUM_OF )
+    {
+        g_sweep = 0U;
+    }
+}
+
+#if ( 1 == BUTTON_CFG_FILTER_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Calculate LPF settle time
+    *
+    * @param[in]    num     - Button enumeration number
+    * @param[in]    fc      - Filter cutoff frequency
+    * @return       time    - Filter settle time. Unit: samples
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static uint16_t button_lpf_settle_time(const button_num_t num, const float32_t fc)
+    {
+        const float32_t tau = ( 1.0f / ( 6.2831853f * fc ));
+
+        return BUTTON_DEB_TIME_TO_TICK(( BUTTON_LPF_SETTLE_TAU * tau ), BUTTON_SAMPLE_PERIOD_S( num ));
+    }
+
+#endif
+
+#if ( 1 == BUTTON_CFG_RUNTIME_CFG_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Apply new configuration table
+    *
+    * @note     Only buttons with changed configuration are set up again, all
+    *           other buttons keep their state.
+    *
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void button_cfg_apply(void)
+    {
+        const button_cfg_t * const  p_old   = gp_cfg_table;
+        const uint32_t              idx     = ( g_cfg_idx ^ 1U );
+        uint32_t                    changed[BUTTON_WORD_NUM] = { 0 };
+        bool                        resched = false;
+
+        // Swap tables
+        gp_cfg_table    = g_cfg_buf[idx];
+        g_cfg_idx       = idx;
+
+        // Release shared resources of changed buttons first, so that they
+        // can be taken by any other changed button (e.g. swapped stream bits)
+        for ( button_num_t num = 0; num < eBUTTON_NUM_OF; num++ )
+        {
+            if ( false == button_cfg_is_equal( &p_old[num], &gp_cfg_table[num] ))
+            {
+                changed[ BUTTON_WORD( num ) ] |= BUTTON_BIT( num );
+
+                #if ( 1 == BUTTON_CFG_STREAM_EN )
+
+                    // Unmap raw port bit
+                    button_stream_release( num );
+
+                #endif
+
+                #if ( 1 == BUTTON_CFG_DERIVED_EN )
+
+                    // Free derived input slot
+                    button_derived_release( num );
+
+                #endif
+            }
+        }
+
+        for ( button_num_t num = 0; num < eBUTTON_NUM_OF; num++ )
+        {
+            if ( 0U != ( changed[ BUTTON_WORD( num ) ] & BUTTON_BIT( num )))
+            {
+                // Sampling rate changed
+                if ( p_old[num].sample_div != gp_cfg_table[num].sample_div )
+                {
+                    resched = true;
+                }
+
+                #if ( 1 == BUTTON_CFG_STATS_EN )
+
+                    // Account active time before held button is reset
+                    if ( eBUTTON_ON == g_button[num].state )
+                    {
+                        button_stats_accrue( num );
+                    }
+
+                #endif
+
+                // Set up button with new configuration
+                button_release( num );
+
+                if ( eBUTTON_OK != button_setup( num ))
+                {
+                    BUTTON_PRINT( "BUTTON: Configuration change error at button number %d!", num );
+                    BUTTON_ASSERT( 0 );
+                }
+            }
+        }
+
+        // Rebuild sampling schedule
+        if ( true == resched )
+        {
+            (void) button_sched_init();
+        }
+
+        // Back table can be written again
+        gb_cfg_pending = false;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Compare button configurations
+    *
+    * @note     Compared field by field, as structure padding is undefined.
+    *           Derived expression terms are compared up to number of terms.
+    *
+    * @param[in]    p_a     - Pointer to first configuration
+    * @param[in]    p_b     - Pointer to second configuration
+    * @return       true if configurations are equal
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static bool button_cfg_is_equal(const button_cfg_t * const p_a, const button_cfg_t * const p_b)
+    {
+        bool is_equal = (   ( p_a->gpio_pin     == p_b->gpio_pin )
+                        &&  ( p_a->polarity     == p_b->polarity )
+                        &&  ( p_a->lpf_en       == p_b->lpf_en )
+                        &&  ( p_a->lpf_fc       == p_b->lpf_fc )
+                        &&  ( p_a->deb_mode     == p_b->deb_mode )
+                        &&  ( p_a->deb_press    == p_b->deb_press )
+                        &&  ( p_a->deb_release  == p_b->deb_release )
+                        &&  ( p_a->sample_div   == p_b->sample_div )
+                        &&  ( p_a->source       == p_b->source )
+                        &&  ( p_a->oversample   == p_b->oversample )
+                        &&  ( p_a->stream_bit   == p_b->stream_bit ));
+
+        #if ( 1 == BUTTON_CFG_DERIVED_EN )
+
+            is_equal = (    ( true == is_equal )
+                        &&  ( p_a->expr.op      == p_b->expr.op )
+                        &&  ( p_a->expr.num_of  == p_b->expr.num_of )
+                        &&  ( p_a->expr.inv     == p_b->expr.inv ));
+
+            for ( uint32_t t = 0U; ( true == is_equal ) && ( t < p_a->expr.num_of ) && ( t < BUTTON_CFG_DERIVED_TERM_MAX ); t++ )
+            {
+                is_equal = ( p_a->expr.term[t] == p_b->expr.term[t] );
+            }
+
+        #endif
+
+        #if ( 1 == BUTTON_CFG_REPEAT_EN )
+
+            is_equal = (    ( true == is_equal )
+                        &&  ( p_a->rep_delay    == p_b->rep_delay )
+                        &&  ( p_a->rep_period   == p_b->rep_period )
+                        &&  ( p_a->rep_accel    == p_b->rep_accel )
+                        &&  ( p_a->rep_min      == p_b->rep_min ));
+
+        #endif
+
+        return is_equal;
+    }
+
+#endif
+
+#if ( 1 == BUTTON_CFG_OVERSAMPLE_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Sample oversampled inputs and reduce reads by majority vote
+    *
+    * @note     Each read pass reads all due oversampled inputs once, so reads
+    *           of single input are spread across whole burst. Active reads are
+    *           counted by bit-sliced (vertical) counters, thus counting and
+    *           majority decision is done for 32 inputs at once.
+    *
+    *           Input with unknown state at any read is reported as unknown,
+    *           as that is GPIO fault rather than noise.
+    *
+    * @param[out]   p_smp   - Bitmask of active inputs
+    * @param[out]   p_unk   - Bitmask of inputs with unknown state
+    * @param[in]    p_due   - Bitmask of sampled buttons
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void button_oversample(uint32_t * const p_smp, uint32_t * const p_unk, const uint32_t * const p_due)
+    {
+        for ( uint32_t w = 0U; w < BUTTON_WORD_NUM; w++ )
+        {
+            const uint32_t  ovs                         = ( g_ovs_mask[w] & p_due[w] );
+            uint32_t        cnt[BUTTON_OVS_CNT_BITS]    = { 0 };
+            uint32_t        unk                         = 0U;
+            uint32_t        ge                          = 0U;
+            uint32_t        eq                          = 0xFFFFFFFFU;
+
+            // Any oversampled input due?
+            if ( 0U != ovs )
+            {
+                for ( uint32_t r = 0U; r < BUTTON_CFG_OVERSAMPLE_NUM; r++ )
+                {
+                    uint32_t todo   = ovs;
+                    uint32_t carry  = 0U;
+
+                    // Read all inputs once
+                    while ( 0U != todo )
+                    {
+                        const button_num_t      num     = (button_num_t)(( w << 5U ) + BUTTON_CTZ( todo ));
+                        const button_state_t    state   = button_get_low( num );
+
+                        if ( eBUTTON_ON == state )
+                        {
+                            carry |= BUTTON_BIT( num );
+                        }
+                        else if ( eBUTTON_UNKNOWN == state )
+                        {
+                            unk |= BUTTON_BIT( num );
+                        }
+                        else
+                        {
+                            // No actions...
+                        }
+
+                        // Clear lowest set bit
+                        todo &= ( todo - 1U );
+                    }
+
+                    // Add reads to counters
+                    for ( uint32_t j = 0U; j < BUTTON_OVS_CNT_BITS; j++ )
+                    {
+                        const uint32_t c = ( cnt[j] & carry );
+
+                        cnt[j] ^= carry;
+                        carry   = c;
+                    }
+                }
+
+                // Compare counters against threshold, from MSB down
+                for ( uint32_t j = BUTTON_OVS_CNT_BITS; j > 0U; j-- )
+                {
+                    if ( 0U != ( BUTTON_OVS_THRESHOLD & ( 1U << ( j - 1U ))))
+                    {
+                        eq &= cnt[j-1U];
+                    }
+                    else
+                    {
+                        ge |= ( eq & cnt[j-1U] );
+                        eq &= ~cnt[j-1U];
+                    }
+                }
+
+                p_smp[w] |= (( ge | eq ) & ovs & ~unk );
+                p_unk[w] |= unk;
+            }
+        }
+    }
+
+#endif
+
+#if ( 1 == BUTTON_CFG_STREAM_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Map button to raw port bit based on its configuration
+    *
+    * @param[in]    num     - Button enumeration number
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void button_stream_setup(const button_num_t num)
+    {
+        // Release previously used bit
+        button_stream_release( num );
+
+        if ( eBUTTON_SRC_STREAM == gp_cfg_table[num].source )
+        {
+            const uint32_t b = gp_cfg_table[num].stream_bit;
+
+            BUTTON_ASSERT( b < BUTTON_STREAM_BITS );
+            BUTTON_ASSERT( eBUTTON_NUM_OF == g_stream_btn[b] );
+
+            if  (   ( b < BUTTON_STREAM_BITS )
+                &&  ( eBUTTON_NUM_OF == g_stream_btn[b] ))
+            {
+                g_stream_btn[b] = num;
+                g_stream_used   |= ( 1U << b );
+                g_stream_new    |= ( 1U << b );
+
+                if ( eBUTTON_POL_ACTIVE_LOW == gp_cfg_table[num].polarity )
+                {
+                    g_stream_inv |= ( 1U << b );
+                }
+
+                g_stream_mask[ BUTTON_WORD( num ) ] |= BUTTON_BIT( num );
+            }
+            else
+            {
+                BUTTON_PRINT( "BUTTON: Invalid stream bit at button number %d!", num );
+            }
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Release raw port bit mapped to button
+    *
+    * @param[in]    num     - Button enumeration number
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void button_stream_release(const button_num_t num)
+    {
+        for ( uint32_t b = 0U; b < BUTTON_STREAM_BITS; b++ )
+        {
+            if ( num == g_stream_btn[b] )
+            {
+                g_stream_btn[b] = eBUTTON_NUM_OF;
+                g_stream_used   &= ~( 1U << b );
+                g_stream_inv    &= ~( 1U << b );
+                g_stream_new    &= ~( 1U << b );
+            }
+        }
+
+        g_stream_mask[ BUTTON_WORD( num ) ] &= ~BUTTON_BIT( num );
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Report debounced edges of port bits to buttons
+    *
+    * @param[in]    bits    - Port bits with changed debounced state
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void button_stream_edge(uint32_t bits)
+    {
+        while ( 0U != bits )
+        {
+            const uint32_t      b       = BUTTON_CTZ( bits );
+            const button_num_t  num     = g_stream_btn[b];
+            const button_state_t state  = ( 0U != ( g_stream_deb & ( 1U << b ))) ? eBUTTON_ON : eBUTTON_OFF;
+
+            g_stream_edge[b] = g_stream_smp;
+
+            if ( state != g_button[num].state )
+            {
+                button_state_change( num, state );
+            }
+
+            // Clear lowest set bit
+            bits &= ( bits - 1U );
+        }
+    }
+
+#endif
+
+#if ( 1 == BUTTON_CFG_DERIVED_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Compile derived input expression into term bitmasks
+    *
+    * @note     Button state is restarted by setup, thus it is marked as
+    *           changed in order to re-evaluate derived inputs using it.
+    *
+    * @param[in]    num     - Button enumeration number
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void button_derived_setup(const button_num_t num)
+    {
+        // Restarted state
+        g_on[ BUTTON_WORD( num ) ]      &= ~BUTTON_BIT( num );
+        g_known[ BUTTON_WORD( num ) ]   &= ~BUTTON_BIT( num );
+        g_changed[ BUTTON_WORD( num ) ] |= BUTTON_BIT( num );
+
+        // Release previously used slot
+        button_derived_release( num );
+
+        if ( eBUTTON_SRC_DERIVED == gp_cfg_table[num].source )
+        {
+            const button_expr_t * const p_expr = &gp_cfg_table[num].expr;
+            uint32_t d = 0U;
+
+            // Find free slot
+            for ( d = 0U; d < BUTTON_CFG_DERIVED_NUM; d++ )
+            {
+                if ( eBUTTON_NUM_OF == g_derived[d].num )
+                {
+                    break;
+                }
+            }
+
+            BUTTON_ASSERT( d < BUTTON_CFG_DERIVED_NUM );
+            BUTTON_ASSERT( p_expr->num_of <= BUTTON_CFG_DERIVED_TERM_MAX );
+
+            if ( d < BUTTON_CFG_DERIVED_NUM )
+            {
+                button_derived_t * const p_der = &g_derived[d];
+
+                p_der->num = num;
+
+                for ( uint32_t w = 0U; w < BUTTON_WORD_NUM; w++ )
+                {
+                    p_der->mask[w]  = 0U;
+                    p_der->inv[w]   = 0U;
+                }
+
+                for ( uint32_t t = 0U; ( t < p_expr->num_of ) && ( t < BUTTON_CFG_DERIVED_TERM_MAX ); t++ )
+                {
+                    const button_num_t term = p_expr->term[t];
+
+                    // Terms shall be real inputs
+                    BUTTON_ASSERT( term < eBUTTON_NUM_OF );
+                    BUTTON_ASSERT( eBUTTON_SRC_DERIVED != gp_cfg_table[term].source );
+
+                    if  (   ( term < eBUTTON_NUM_OF )
+                        &&  ( eBUTTON_SRC_DERIVED != gp_cfg_table[term].source ))
+                    {
+                        p_der->mask[ BUTTON_WORD( term ) ] |= BUTTON_BIT( term );
+
+                        if ( 0U != ( p_expr->inv & ( 1U << t )))
+                        {
+                            p_der->inv[ BUTTON_WORD( term ) ] |= BUTTON_BIT( term );
+                        }
+
+                        // Evaluate at next handler call
+                        g_changed[ BUTTON_WORD( term ) ] |= BUTTON_BIT( term );
+                    }
+                }
+
+                g_derived_mask[ BUTTON_WORD( num ) ] |= BUTTON_BIT( num );
+            }
+            else
+            {
+                BUTTON_PRINT( "BUTTON: No free derived input slot for button number %d!", num );
+            }
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Release derived input slot used by button
+    *
+    * @param[in]    num     - Button enumeration number
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void button_derived_release(const button_num_t num)
+    {
+        for ( uint32_t d = 0U; d < BUTTON_CFG_DERIVED_NUM; d++ )
+        {
+            if ( num == g_derived[d].num )
+            {
+                g_derived[d].num = eBUTTON_NUM_OF;
+            }
+        }
+
+        g_derived_mask[ BUTTON_WORD( num ) ] &= ~BUTTON_BIT( num );
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Evaluate derived inputs
+    *
+    * @note     Derived input is evaluated only when one of its terms changed
+    *           state. Derived input is unknown until all of its terms are
+    *           known.
+    *
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void button_derived_hndl(void)
+    {
+        uint32_t changed = 0U;
+
+        for ( uint32_t w = 0U; w < BUTTON_WORD_NUM; w++ )
+        {
+            changed |= g_changed[w];
+        }
+
+        // Any button changed?
+        if ( 0U != changed )
+        {
+            for ( uint32_t d = 0U; d < BUTTON_CFG_DERIVED_NUM; d++ )
+            {
+                const button_derived_t * const p_der = &g_derived[d];
+
+                if ( eBUTTON_NUM_OF != p_der->num )
+                {
+                    bool hit    = false;
+                    bool known  = true;
+                    bool all    = true;
+                    bool any    = false;
+
+                    for ( uint32_t w = 0U; w < BUTTON_WORD_NUM; w++ )
+                    {
+                        const uint32_t act = (( g_on[w] ^ p_der->inv[w] ) & p_der->mask[w] );
+
+                        hit     |= ( 0U != ( g_changed[w] & p_der->mask[w] ));
+                        known   &= ( p_der->mask[w] == ( g_known[w] & p_der->mask[w] ));
+                        all     &= ( p_der->mask[w] == act );
+                        any     |= ( 0U != act );
+                    }
+
+                    if ( true == hit )
+                    {
+                        button_state_t state = eBUTTON_UNKNOWN;
+
+                        if ( true == known )
+                        {
+                            const bool on = ( eBUTTON_EXPR_OR == gp_cfg_table[ p_der->num ].expr.op ) ? any : all;
+
+                            state = ( true == on ) ? eBUTTON_ON : eBUTTON_OFF;
+                        }
+
+                        if ( state != g_button[ p_der->num ].state )
+                        {
+                            button_state_change( p_der->num, state );
+                        }
+                    }
+                }
+            }
+
+            for ( uint32_t w = 0U; w < BUTTON_WORD_NUM; w++ )
+            {
+                g_changed[w] = 0U;
+            }
+        }
+    }
+
+#endif
+
+#if ( 1 == BUTTON_CFG_REPEAT_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Start auto-repeat of pressed button
+    *
+    * @param[in]    num     - Button enumeration number
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void button_repeat_start(const button_num_t num)
+    {
+        if ( gp_cfg_table[num].rep_delay > 0.0f )
+        {
+            if ( g_repeat_num < BUTTON_CFG_REPEAT_NUM )
+            {
+                const uint16_t  period  = BUTTON_DEB_TIME_TO_TICK( gp_cfg_table[num].rep_period, BUTTON_HNDL_PERIOD_S );
+                const uint32_t  i       = g_repeat_num;
+
+                g_repeat[i].due     = ( g_tick + BUTTON_DEB_TIME_TO_TICK( gp_cfg_table[num].rep_delay, BUTTON_HNDL_PERIOD_S ));
+                g_repeat[i].period  = ( period > 0U ) ? period : 1U;
+                g_repeat[i].cnt     = 0U;
+                g_repeat[i].num     = num;
+                g_repeat_num++;
+
+                button_repeat_sift_up( i );
+            }
+            else
+            {
+                BUTTON_PRINT( "BUTTON: Too many repeating buttons, button number %d not repeated!", num );
+            }
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Stop auto-repeat of button
+    *
+    * @note     Heap is small, thus repeat of button is searched linearly.
+    *
+    * @param[in]    num     - Button enumeration number
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void button_repeat_stop(const button_num_t num)
+    {
+        for ( uint32_t i = 0U; i < g_repeat_num; i++ )
+        {
+            if ( num == g_repeat[i].num )
+            {
+                // Replace with last one
+                g_repeat_num--;
+                g_repeat[i] = g_repeat[g_repeat_num];
+
+                if ( i < g_repeat_num )
+                {
+                    button_repeat_sift_up( i );
+                    button_repeat_sift_down( i );
+                }
+
+                break;
+            }
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Restore heap order above repeat at position "i"
+    *
+    * @param[in]    i   - Heap position
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void button_repeat_sift_up(uint32_t i)
+    {
+        while (( i > 0U ) && ( BUTTON_REPEAT_BEFORE( g_repeat[i], g_repeat[( i - 1U ) / 2U] )))
+        {
+            const button_repeat_t tmp = g_repeat[i];
+
+            g_repeat[i] = g_repeat[( i - 1U ) / 2U];
+            g_repeat[( i - 1U ) / 2U] = tmp;
+            i = (( i - 1U ) / 2U );
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Restore heap order below repeat at position "i"
+    *
+    * @param[in]    i   - Heap position
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void button_repeat_sift_down(uint32_t i)
+    {
+        for (;;)
+        {
+            const uint32_t  l       = (( 2U * i ) + 1U );
+            const uint32_t  r       = ( l + 1U );
+            uint32_t        first   = i;
+
+            if (( l < g_repeat_num ) && ( BUTTON_REPEAT_BEFORE( g_repeat[l], g_repeat[first] )))
+            {
+                first = l;
+            }
+
+            if (( r < g_repeat_num ) && ( BUTTON_REPEAT_BEFORE( g_repeat[r], g_repeat[first] )))
+            {
+                first = r;
+            }
+
+            if ( first == i )
+            {
+                break;
+            }
+            else
+            {
+                const button_repeat_t tmp = g_repeat[i];
+
+                g_repeat[i]     = g_repeat[first];
+                g_repeat[first] = tmp;
+                i = first;
+            }
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Report due auto-repeats
+    *
+    * @note     Only earliest repeat is checked when nothing is due. Repeat is
+    *           reported via pressed callback (and telemetry gesture event),
+    *           if button is enabled.
+    *
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void button_repeat_hndl(void)
+    {
+        while   (   ( g_repeat_num > 0U )
+                &&  ((int32_t)( g_tick - g_repeat[0].due ) >= 0 ))
+        {
+            button_repeat_t * const     p_rep   = &g_repeat[0];
+            const button_num_t          num     = p_rep->num;
+
+            if ( p_rep->cnt < 0xFFFFU )
+            {
+                p_rep->cnt++;
+            }
+
+            if ( true == g_button[num].enable )
+            {
+                if ( NULL != BUTTON_PRESSED_CB( num ))
+                {
+                    BUTTON_PRESSED_CB( num )();
+                }
+
+                #if ( 1 == BUTTON_CFG_TLM_EN )
+                    button_tlm_put( eBUTTON_TLM_EVT_GESTURE, (uint32_t) num, g_tick, BUTTON_TLM_GESTURE_DATA( eBUTTON_TLM_GESTURE_REPEAT, p_rep->cnt ));
+                #endif
+            }
+
+            // Next repeat
+            p_rep->due += p_rep->period;
+
+            // Accelerate
+            if  (   ( gp_cfg_table[num].rep_accel > 0.0f )
+                &&  ( gp_cfg_table[num].rep_accel < 1.0f ))
+            {
+                const uint16_t  lim     = BUTTON_DEB_TIME_TO_TICK( gp_cfg_table[num].rep_min, BUTTON_HNDL_PERIOD_S );
+                const uint16_t  period  = (uint16_t)((float32_t) p_rep->period * gp_cfg_table[num].rep_accel );
+
+                p_rep->period = ( period > lim ) ? period : lim;
+
+                if ( 0U == p_rep->period )
+                {
+                    p_rep->period = 1U;
+                }
+            }
+
+            button_repeat_sift_down( 0U );
+        }
+    }
+
+#endif
+
+#if ( 1 == BUTTON_CFG_SEQ_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Build sequence automaton from registered sequences
+    *
+    * @note     Sequences are inserted into trie, then failure links are found
+    *           in breadth-first order and missing transitions are replaced by
+    *           transitions of failure state. Step timeout of state is the
+    *           longest one of sequences continuing from it, thus recognizer
+    *           is not restarted while any sequence can still continue. Own
+    *           step timeout of sequence is checked at its completion.
+    *
+    * @return       status - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static button_status_t button_seq_build(void)
+    {
+        button_status_t status                          = eBUTTON_OK;
+        uint8_t         fail[BUTTON_CFG_SEQ_STATE_NUM]  = { 0 };
+        uint8_t         queue[BUTTON_CFG_SEQ_STATE_NUM] = { 0 };
+        uint32_t        state_num                       = 1U;
+        uint32_t        head                            = 0U;
+        uint32_t        tail                            = 0U;
+
+        // Clear automaton
+        memset( g_seq_dfa, 0, sizeof( g_seq_dfa ));
+        memset( g_seq_used, 0, sizeof( g_seq_used ));
+
+        for ( uint32_t s = 0U; s < BUTTON_CFG_SEQ_STATE_NUM; s++ )
+        {
+            g_seq_out[s]        = BUTTON_SEQ_NONE;
+            g_seq_dict[s]       = 0U;
+            g_seq_timeout[s]    = 0U;
+        }
+
+        // Insert sequences into trie
+        for ( uint32_t i = 0U; ( i < BUTTON_CFG_SEQ_NUM ) && ( eBUTTON_OK == status ); i++ )
+        {
+            uint32_t s = 0U;
+
+            for ( uint32_t k = 0U; k < g_seq[i].len; k++ )
+            {
+                const button_num_t num = g_seq[i].btn[k];
+
+                // New state
+                if ( 0U == g_seq_dfa[s][num] )
+                {
+                    if ( state_num < BUTTON_CFG_SEQ_STATE_NUM )
+                    {
+                        g_seq_dfa[s][num] = (uint8_t) state_num;
+                        state_num++;
+                    }
+                    else
+                    {
+                        status = eBUTTON_ERROR;
+                        break;
+                    }
+                }
+
+                if ( g_seq_timeout[s] < g_seq[i].timeout )
+                {
+                    g_seq_timeout[s] = g_seq[i].timeout;
+                }
+
+                g_seq_used[ BUTTON_WORD( num ) ] |= BUTTON_BIT( num );
+                s = g_seq_dfa[s][num];
+            }
+
+            if (( eBUTTON_OK == status ) && ( g_seq[i].len > 0U ))
+            {
+                g_seq_out[s] = (uint8_t) i;
+            }
+        }
+
+        if ( eBUTTON_OK == status )
+        {
+            // States at depth one fail to root
+            for ( button_num_t num = 0; num < eBUTTON_NUM_OF; num++ )
+            {
+                if ( 0U != g_seq_dfa[0][num] )
+                {
+                    queue[tail] = g_seq_dfa[0][num];
+                    tail++;
+                }
+            }
+
+            // Breadth-first over trie
+            while ( head < tail )
+            {
+                const uint32_t s = queue[head];
+                head++;
+
+                for ( button_num_t num = 0; num < eBUTTON_NUM_OF; num++ )
+                {
+                    const uint32_t t = g_seq_dfa[s][num];
+
+                    // Trie state
+                    if ( 0U != t )
+                    {
+                        const uint8_t f = g_seq_dfa[ fail[s] ][num];
+
+                        fail[t]         = f;
+                        g_seq_dict[t]   = ( BUTTON_SEQ_NONE != g_seq_out[f] ) ? f : g_seq_dict[f];
+
+                        // Waiting in state also continues sequences of failure state
+                        if ( g_seq_timeout[t] < g_seq_timeout[f] )
+                        {
+                            g_seq_timeout[t] = g_seq_timeout[f];
+                        }
+
+                        queue[tail] = (uint8_t) t;
+                        tail++;
+                    }
+
+                    // Resolve failure transition
+                    else
+                    {
+                        g_seq_dfa[s][num] = g_seq_dfa[ fail[s] ][num];
+                    }
+                }
+            }
+        }
+        else
+        {
+            memset( g_seq_dfa, 0, sizeof( g_seq_dfa ));
+            BUTTON_PRINT( "BUTTON: Too many sequence automaton states!" );
+        }
+
+        // Restart recognizer
+        g_seq_state = 0U;
+        g_seq_press[g_seq_pos] = g_tick;
+
+        return status;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Advance sequence automaton on button press
+    *
+    * @note     Constant cost per press, regardless of number of sequences.
+    *           Step timeout is checked at press, so handler has no extra work
+    *           between presses.
+    *
+    * @param[in]    num     - Button enumeration number
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void button_seq_edge(const button_num_t num)
+    {
+        if ( 0U != ( g_seq_used[ BUTTON_WORD( num ) ] & BUTTON_BIT( num )))
+        {
+            // Step timeout elapsed
+            if (( g_tick - g_seq_press[g_seq_pos] ) > g_seq_timeout[g_seq_state] )
+            {
+                g_seq_state = 0U;
+            }
+
+            g_seq_state = g_seq_dfa[g_seq_state][num];
+
+            // Store press tick
+            g_seq_pos++;
+
+            if ( g_seq_pos >= BUTTON_CFG_SEQ_LEN_MAX )
+            {
+                g_seq_pos = 0U;
+            }
+
+            g_seq_press[g_seq_pos] = g_tick;
+
+            // Report completed sequences
+            for ( uint32_t s = g_seq_state; 0U != s; s = g_seq_dict[s] )
+            {
+                const uint32_t i = g_seq_out[s];
+
+                if  (   ( BUTTON_SEQ_NONE != i )
+                    &&  ( true == button_seq_in_time( i )))
+                {
+                    if ( NULL != g_seq[i].pf_done )
+                    {
+                        g_seq[i].pf_done();
+                    }
+
+                    #if ( 1 == BUTTON_CFG_TLM_EN )
+                        button_tlm_put( eBUTTON_TLM_EVT_GESTURE, (uint32_t) num, g_tick, BUTTON_TLM_GESTURE_DATA( eBUTTON_TLM_GESTURE_SEQUENCE, i ));
+                    #endif
+                }
+            }
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Check step timeouts of just completed sequence
+    *
+    * @note     Automaton step timeout is the longest one of all sequences
+    *           sharing the state, thus each step of completed sequence is
+    *           checked against its own timeout here. Sequence of length "len"
+    *           is made of last "len" presses of sequence buttons.
+    *
+    * @param[in]    i       - Sequence ID
+    * @return       true if all steps were within sequence step timeout
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static bool button_seq_in_time(const uint32_t i)
+    {
+        bool        in_time = true;
+        uint32_t    pos     = g_seq_pos;
+
+        for ( uint32_t k = 1U; ( k < g_seq[i].len ) && ( true == in_time ); k++ )
+        {
+            const uint32_t prev = ( 0U == pos ) ? ( BUTTON_CFG_SEQ_LEN_MAX - 1U ) : ( pos - 1U );
+
+            in_time = (( g_seq_press[pos] - g_seq_press[prev] ) <= g_seq[i].timeout );
+            pos     = prev;
+        }
+
+        return in_time;
+    }
+
+#endif
+
+#if ( 1 == BUTTON_CFG_TLM_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Report buttons with input that just became unknown
+    *
+    * @param[in]    w       - Bitmask word index
+    * @param[in]    unk     - Bitmask word of inputs with unknown state
+    * @param[in]    due     - Bitmask word of sampled buttons
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void button_tlm_fault(const uint32_t w, const uint32_t unk, const uint32_t due)
+    {
+        uint32_t fault = ( unk & ~g_unk[w] );
+
+        g_unk[w] = (( g_unk[w] & ~due ) | unk );
+
+        while ( 0U != fault )
+        {
+            button_tlm_put( eBUTTON_TLM_EVT_FAULT, (( w << 5U ) + BUTTON_CTZ( fault )), g_tick, eBUTTON_TLM_FAULT_GPIO );
+
+            // Clear lowest set bit
+            fault &= ( fault - 1U );
+        }
+    }
+
+#endif
+
+#if ( 1 == BUTTON_CFG_SELF_CHECK_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Check buttons skipped by handler fast path
+    *
+    * @note     Sampled button is skipped only if per-button reference path
+    *           would not change its state: debouncer is idle and debounced
+    *           state equals input. Any violation means that optimized
+    *           handler diverges from reference.
+    *
+    * @param[in]    p_smp   - Bitmask of active inputs
+    * @param[in]    p_unk   - Bitmask of inputs with unknown state
+    * @param[in]    p_due   - Bitmask of sampled buttons
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void button_self_check(const uint32_t * const p_smp, const uint32_t * const p_unk, const uint32_t * const p_due)
+    {
+        for ( button_num_t num = 0; num < eBUTTON_NUM_OF; num++ )
+        {
+            const uint32_t w    = BUTTON_WORD( num );
+            const uint32_t bit  = BUTTON_BIT( num );
+
+            // Sampled, but skipped
+            if  (   ( 0U != ( p_due[w] & bit ))
+                &&  ( 0U == ( g_settle[w] & bit )))
+            {
+                const button_state_t state_in = ( 0U != ( p_unk[w] & bit )) ? eBUTTON_UNKNOWN : (( 0U != ( p_smp[w] & bit )) ? eBUTTON_ON : eBUTTON_OFF );
+
+                // Raw sample shall be stored
+                const bool raw_ok = (( 0U != ( g_raw[w] & bit )) == ( eBUTTON_ON == state_in ));
+
+                if  (   ( false == raw_ok )
+                    ||  ( state_in != g_button[num].state )
+                    ||  ( true == button_deb_is_busy( num, state_in )))
+                {
+                    BUTTON_PRINT( "BUTTON: Self-check failed at button number %d!", num );
+                    BUTTON_ASSERT( 0 );
+                }
+            }
+        }
+    }
+
+#endif
+
+#if ( 1 == BUTTON_CFG_STATS_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Initialize button statistics
+    *
+    * @note     In case of invalid data in NVM (e.g. first power-up) statistics
+    *           start from zero.
+    *
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void button_stats_init(void)
+    {
+        // Load statistics
+        if  (   ( false == button_cfg_stats_load( &g_stats, sizeof( g_stats )))
+            ||  ( BUTTON_STATS_SIGN != g_stats.sign )
+            ||  ( button_stats_crc( &g_stats ) != g_stats.crc ))
+        {
+            BUTTON_PRINT( "BUTTON: Invalid statistics, starting from zero!" );
+
+            for ( button_num_t num = 0; num < eBUTTON_NUM_OF; num++ )
+            {
+                g_stats.btn[num].press_cnt  = 0U;
+                g_stats.btn[num].active_s   = 0U;
+            }
+
+            g_stats.sign = BUTTON_STATS_SIGN;
+        }
+
+        for ( button_num_t num = 0; num < eBUTTON_NUM_OF; num++ )
+        {
+            g_stats_rem[num]    = 0.0f;
+            g_stats_tick[num]   = g_tick;
+        }
+
+        g_stats_dirty       = 0U;
+        g_stats_flush_tick  = g_tick;
+        gb_stats_fail       = false;
+        gb_stats_time       = false;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Update button statistics on state change
+    *
+    * @note     Active time is accounted when button leaves active state.
+    *
+    * @param[in]    num         - Button enumeration number
+    * @param[in]    state_cur   - Current state of button
+    * @param[in]    state_prev  - Previous state of button
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void button_stats_update(const button_num_t num, const button_state_t state_cur, const button_state_t state_prev)
+    {
+        // Press
+        if  (   ( eBUTTON_ON  == state_cur )
+            &&  ( eBUTTON_OFF == state_prev ))
+        {
+            g_stats.btn[num].press_cnt++;
+            g_stats_dirty++;
+        }
+
+        // Leaving active state
+        if ( eBUTTON_ON == state_prev )
+        {
+            button_stats_accrue( num );
+        }
+
+        // Entering active state
+        else if ( eBUTTON_ON == state_cur )
+        {
+            g_stats_tick[num] = g_tick;
+        }
+
+        else
+        {
+            // No actions...
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Account active time of button up to current tick
+    *
+    * @note     Sub-second part is kept, so that short presses add up.
+    *
+    * @param[in]    num         - Button enumeration number
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void button_stats_accrue(const button_num_t num)
+    {
+        g_stats_rem[num]    += ((float32_t)( g_tick - g_stats_tick[num] ) * BUTTON_HNDL_PERIOD_S );
+        g_stats_tick[num]   = g_tick;
+
+        if ( g_stats_rem[num] >= 1.0f )
+        {
+            const uint32_t sec = (uint32_t) g_stats_rem[num];
+
+            g_stats.btn[num].active_s += sec;
+            g_stats_rem[num] -= (float32_t) sec;
+            gb_stats_time = true;
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Account active time of all held buttons up to current tick
+    *
+    * @note     Called before statistics are stored outside of handler.
+    *
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void button_stats_held(void)
+    {
+        for ( button_num_t num = 0; num < eBUTTON_NUM_OF; num++ )
+        {
+            if ( eBUTTON_ON == g_button[num].state )
+            {
+                button_stats_accrue( num );
+            }
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Store statistics when enough events are collected or after flush period
+    *
+    * @note     After failed store, NVM is not written again before flush
+    *           period elapses, regardless of number of events.
+    *
+    * @note     Active time alone is stored only after flush period.
+    *
+    * @return       void
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static void button_stats_hndl(void)
+    {
+        if  (   ( g_stats_dirty > 0U )
+            ||  ( true == gb_stats_time ))
+        {
+            const bool period_elapsed = (( g_tick - g_stats_flush_tick ) >= BUTTON_STATS_FLUSH_TICK );
+
+            if  (   ( true == period_elapsed )
+                ||  (   ( false == gb_stats_fail )
+                    &&  ( g_stats_dirty >= BUTTON_CFG_STATS_FLUSH_EVENTS )))
+            {
+                (void) button_stats_store();
+            }
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Store statistics to NVM
+    *
+    * @note     On failure store is retried after flush period.
+    *
+    * @return       status - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static button_status_t button_stats_store(void)
+    {
+        button_status_t status = eBUTTON_OK;
+
+        g_stats.crc         = button_stats_crc( &g_stats );
+        g_stats_flush_tick  = g_tick;
+
+        if ( true == button_cfg_stats_store( &g_stats, sizeof( g_stats )))
+        {
+            g_stats_dirty = 0U;
+            gb_stats_fail = false;
+            gb_stats_time = false;
+        }
+        else
+        {
+            BUTTON_PRINT( "BUTTON: Statistics store error!" );
+            gb_stats_fail = true;
+            status = eBUTTON_ERROR;
+        }
+
+        return status;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Calculate statistics record checksum
+    *
+    * @note     FNV-1a 32-bit hash over record without checksum field.
+    *
+    * @param[in]    p_rec   - Pointer to statistics record
+    * @return       crc     - Checksum
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static uint32_t button_stats_crc(const button_stats_rec_t * const p_rec)
+    {
+        const uint8_t * const   p_data  = (const uint8_t*) p_rec;
+        uint32_t                crc     = 0x811C9DC5U;
+
+        for ( uint32_t i = 0U; i < offsetof( button_stats_rec_t, crc ); i++ )
+        {
+            crc ^= p_data[i];
+            crc *= 0x01000193U;
+        }
+
+        return crc;
+    }
+
+#endif
+
+#if !defined( __GNUC__ )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Count trailing zeros
+    *
+    * @param[in]    x   - Non-zero word
+    * @return       n   - Number of trailing zero bits
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    static uint32_t button_ctz(uint32_t x)
+    {
+        uint32_t n = 0U;
+
+        while ( 0U == ( x & 1U ))
+        {
+            x >>= 1U;
+            n++;
+        }
+
+        return n;
+    }
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+ * @} <!-- END GROUP -->
+ */
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup BUTTON_API
+* @{ <!-- BEGIN GROUP -->
+*
+*     Following functions are part of API calls.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Button initialization
+*
+* @return       status - Status of initialization
+*/
+////////////////////////////////////////////////////////////////////////////////
+button_status_t button_init(void)
+{
+    button_status_t status = eBUTTON_OK;
+
+    if ( false == gb_is_init )
+    {
+        // Get configuration table
+        gp_cfg_table = button_cfg_get_table();
+
+        if ( NULL != gp_cfg_table )
+        {
+            // Check low level drivers
+            if ( eBUTTON_OK == button_check_drv_init())
+            {
+                // Init internal button data
+                status = button_internal_init();
+
+                // Init success
+                if ( eBUTTON_OK == status )
+                {
+                    gb_is_init = true;
+                }
+            }
+
+            // Low level drivers not initialised
+            else
+            {
+                BUTTON_PRINT( "BUTTON: Low level drivers not initialised error!" );
+                BUTTON_ASSERT( 0 );
+                status = eBUTTON_ERROR_INIT;
+            }
+        }
+        else
+        {
+            BUTTON_PRINT( "BUTTON: Low level drivers not initialised error!" );
+            BUTTON_ASSERT( 0 );
+            status = eBUTTON_ERROR_INIT;
+        }
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Button de-nitialization
+*
+* @note     All button resources are released, so that module can be
+*           initialized again with "button_init()".
+*
+* @return       status - Status of de-init
+*/
+////////////////////////////////////////////////////////////////////////////////
+button_status_t button_deinit(void)
+{
+    button_status_t status = eBUTTON_OK;
+
+    if ( true == gb_is_init )
+    {
+        #if ( 1 == BUTTON_CFG_STATS_EN )
+
+            // Store unstored statistics, including running presses
+            button_stats_held();
+
+            if  (   ( g_stats_dirty > 0U )
+                ||  ( true == gb_stats_time ))
+            {
+                status = button_stats_store();
+            }
+
+        #endif
+
+        // Release filters
+        button_internal_deinit();
+
+        gb_is_init = false;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get button initialisation state
+*
+* @param[out]   p_is_init   - Initialization state
+* @return       status      - Status of initialization
+*/
+////////////////////////////////////////////////////////////////////////////////
+button_status_t button_is_init(bool * const p_is_init)
+{
+    button_status_t status = eBUTTON_OK;
+
+    if ( NULL != p_is_init )
+    {
+        *p_is_init = gb_is_init;
+    }
+    else
+    {
+        status = eBUTTON_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Main button handler
+*
+*@note     This function shall be called with constant period of value
+*          set in "button_cfg.h" with macro "BUTTON_CFG_HNDL_PERIOD_S".
+*
+*@note     Each call only buttons due by its sampling divider are sampled.
+*          Out of sampled buttons only the ones with changed input or with
+*          debouncer still settling are processed, thus handler cost depends
+*          on input activity rather than on number of buttons. Buttons with
+*          LPF are processed until their filter settles.
+*
+* @return       status - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+button_status_t button_hndl(void)
+{
+    button_status_t status = eBUTTON_OK;
+
+    BUTTON_ASSERT( true == gb_is_init );
+
+    if ( true == gb_is_init )
+    {
+        uint32_t smp[BUTTON_WORD_NUM] = { 0 };
+        uint32_t unk[BUTTON_WORD_NUM] = { 0 };
+        uint32_t due[BUTTON_WORD_NUM] = { 0 };
+
+        // Advance time base
+        g_tick++;
+
+        #if ( 1 == BUTTON_CFG_RUNTIME_CFG_EN )
+
+            // Apply new configuration at tick boundary
+            if ( true == gb_cfg_pending )
+            {
+                button_cfg_apply();
+            }
+
+        #endif
+
+        // Sample buttons due at this call
+        button_sample( smp, unk, due );
+
+        // Process only changed or settling buttons
+        for ( uint32_t w = 0U; w < BUTTON_WORD_NUM; w++ )
+        {
+            uint32_t active = ((( smp[w] ^ g_raw[w] ) | unk[w] | g_settle[w] ) & due[w] );
+
+            // Store samples
+            g_raw[w] = (( g_raw[w] & ~due[w] ) | smp[w] );
+
+            #if ( 1 == BUTTON_CFG_TLM_EN )
+
+                // Report inputs that just became unknown
+                button_tlm_fault( w, unk[w], due[w] );
+
+            #endif
+
+            while ( 0U != active )
+            {
+                const uint32_t      bit = BUTTON_CTZ( active );
+                const button_num_t  num = (button_num_t)(( w << 5U ) + bit );
+                button_state_t      state_in = eBUTTON_OFF;
+
+                if ( 0U != ( unk[w] & ( 1UL << bit )))
+                {
+                    state_in = eBUTTON_UNKNOWN;
+                }
+                else if ( 0U != ( smp[w] & ( 1UL << bit )))
+                {
+                    state_in = eBUTTON_ON;
+                }
+                else
+                {
+                    state_in = eBUTTON_OFF;
+                }
+
+                button_process( num, state_in );
+
+                // Clear lowest set bit
+                active &= ( active - 1U );
+            }
+        }
+
+        #if ( 1 == BUTTON_CFG_SELF_CHECK_EN )
+
+            // Compare fast path against reference
+            button_self_check( smp, unk, due );
+
+        #endif
+
+        #if ( 1 == BUTTON_CFG_DERIVED_EN )
+
+            // Evaluate derived inputs with changed terms
+            button_derived_hndl();
+
+        #endif
+
+        #if ( 1 == BUTTON_CFG_REPEAT_EN )
+
+            // Report due auto-repeats
+            button_repeat_hndl();
+
+        #endif
+
+        // Keep timings within limits
+        button_limit_time();
+
+        #if ( 1 == BUTTON_CFG_STATS_EN )
+
+            // Store statistics if needed
+            button_stats_hndl();
+
+        #endif
+    }
+    else
+    {
+        status = eBUTTON_ERROR_INIT;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get current button state
+*
+* @note In case button is disabled, "eBUTTON_UNKNOWN" is returned!
+*
+* @param[in]    num     - Button enumeration number
+* @param[out]   p_state - Pointer to current button state
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+button_status_t button_get_state(const button_num_t num, button_state_t * const p_state)
+{
+    button_status_t status = eBUTTON_OK;
+
+    BUTTON_ASSERT( true == gb_is_init );
+    BUTTON_ASSERT( num < eBUTTON_NUM_OF );
+    BUTTON_ASSERT( NULL != p_state );
+
+    if ( true == gb_is_init )
+    {
+        if ( true == g_button[num].enable )
+        {
+            if  (   ( num < eBUTTON_NUM_OF )
+                &&  ( NULL != p_state ))
+            {
+                *p_state = g_button[num].state;
+            }
+            else
+            {
+                status = eBUTTON_ERROR;
+            }
+        }
+        else
+        {
+            *p_state = eBUTTON_UNKNOWN;     
+        }
+    }
+    else
+    {
+        status = eBUTTON_ERROR_INIT;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get button timings
+*
+* @param[in]    num             - Button enumeration number
+* @param[out]   p_active_time   - Pointer to button active time
+* @param[out]   p_idle_time     - Pointer to button idle time
+* @return       status          - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+button_status_t button_get_time(const button_num_t num, float32_t * const p_active_time, float32_t * const p_idle_time)
+{
+    button_status_t status = eBUTTON_OK;
+
+    BUTTON_ASSERT( true == gb_is_init );
+    BUTTON_ASSERT( num < eBUTTON_NUM_OF );
+
+    if ( true == gb_is_init )
+    {
+        if ( num < eBUTTON_NUM_OF )
+        {
+            float32_t active    = 0.0f;
+            float32_t idle      = 0.0f;
+
+            // Timings are measured only for enabled buttons
+            if  (   ( true == g_button[num].enable )
+                &&  ( eBUTTON_UNKNOWN != g_button[num].state ))
+            {
+                uint32_t elapsed = BUTTON_ELAPSED_TICK( num );
+
+                if ( elapsed > BUTTON_LIM_TICK )
+                {
+                    elapsed = BUTTON_LIM_TICK;
+                }
+
+                if ( eBUTTON_ON == g_button[num].state )
+                {
+                    active = ((float32_t) elapsed * BUTTON_HNDL_PERIOD_S );
+                }
+                else
+                {
+                    idle = ((float32_t) elapsed * BUTTON_HNDL_PERIOD_S );
+                }
+            }
+
+            if ( NULL != p_active_time )
+            {
+                *p_active_time = active;
+            }
+
+            if ( NULL != p_idle_time )
+            {
+                *p_idle_time = idle;
+            }
+        }
+        else
+        {
+            status = eBUTTON_ERROR;
+        }
+    }
+    else
+    {
+        status = eBUTTON_ERROR_INIT;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Enable/Disable button reading
+*
+* @param[in]    num     - Button enumeration number
+* @param[in]    enable  - Enable/Disable button reading
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+button_status_t button_set_enable(const button_num_t num, const bool enable)
+{
+    button_status_t status = eBUTTON_OK;
+
+    BUTTON_ASSERT( true == gb_is_init );
+    BUTTON_ASSERT( num < eBUTTON_NUM_OF );
+
+    if ( true == gb_is_init )
+    {
+        if ( num < eBUTTON_NUM_OF )
         {
-            // Convert state
-            if ( eBUTTON_ON == state )
+            // Timings restart at next handler call when enabled
+            if  (   ( true == enable )
+                &&  ( false == g_button[num].enable ))
             {
-                in = true;
+                g_button[num].edge = (button_tick_t)( g_tick + 1U );
+            }
+
+            g_button[num].enable = enable;
+        }
+        else
+        {
+            status = eBUTTON_ERROR;
+        }
+    }
+    else
+    {
+        status = eBUTTON_ERROR_INIT;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get enable button state
+*
+* @param[in]    num         - Button enumeration number
+* @param[out]   p_enable    - State of enable button switch
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+button_status_t button_get_enable(const button_num_t num, bool * const p_enable)
+{
+    button_status_t status = eBUTTON_OK;
+
+    BUTTON_ASSERT( true == gb_is_init );
+    BUTTON_ASSERT( num < eBUTTON_NUM_OF );
+    BUTTON_ASSERT( NULL != p_enable );
+
+    if ( true == gb_is_init )
+    {
+        if  (   ( num < eBUTTON_NUM_OF )
+            &&  ( NULL != p_enable ))
+        {
+            *p_enable = g_button[num].enable;
+        }
+        else
+        {
+            status = eBUTTON_ERROR;
+        }
+    }
+    else
+    {
+        status = eBUTTON_ERROR_INIT;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Register button press and release callbacks
+*
+* @brief    It is allowed to pass NULL pointer for if only one callback
+*           functions is needed!
+*
+* @param[in]    num         - Button enumeration number
+* @param[in]    pf_pressed  - Pointer to pressed callback function
+* @param[in]    pf_released - Pointer to release callback function
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+button_status_t button_register_callback(const button_num_t num, pf_button_callback pf_pressed, pf_button_callback pf_released)
+{
+    button_status_t status = eBUTTON_OK;
+
+    BUTTON_ASSERT( true == gb_is_init );
+    BUTTON_ASSERT( num < eBUTTON_NUM_OF );
+
+    if ( true == gb_is_init )
+    {
+        if ( num < eBUTTON_NUM_OF )
+        {
+            // Checking for NULL at call
+            status = button_set_callback( num, pf_pressed, pf_released );
+        }
+        else
+        {
+            status = eBUTTON_ERROR;
+        }
+    }
+    else
+    {
+        status = eBUTTON_ERROR_INIT;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Un-register button press and release callbacks
+*
+* @param[in]    num     - Button enumeration number
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+button_status_t button_unregister_callback(const button_num_t num)
+{
+    button_status_t status = eBUTTON_OK;
+
+    BUTTON_ASSERT( true == gb_is_init );
+    BUTTON_ASSERT( num < eBUTTON_NUM_OF );
+
+    if ( true == gb_is_init )
+    {
+        if ( num < eBUTTON_NUM_OF )
+        {
+            (void) button_set_callback( num, NULL, NULL );
+        }
+        else
+        {
+            status = eBUTTON_ERROR;
+        }
+    }
+    else
+    {
+        status = eBUTTON_ERROR_INIT;
+    }
+
+    return status;
+}
+
+#if ( 1 == BUTTON_CFG_FILTER_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Reset button de-bouncing filter
+    *
+    * @note     This function is recommended to be called after enabling
+    *           button reading back from disabled state!
+    *
+    * @param[in]    num     - Button enumeration number
+    * @return       status  - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    button_status_t button_reset_filter(const button_num_t num)
+    {
+        button_status_t status = eBUTTON_OK;
+
+        BUTTON_ASSERT( true == gb_is_init );
+        BUTTON_ASSERT( num < eBUTTON_NUM_OF );
+
+        if ( true == gb_is_init )
+        {
+            if ( num < eBUTTON_NUM_OF )
+            {
+                // Reset debounce counter
+                g_button[num].deb.cnt = 0U;
+
+                // Process button at next sample
+                g_settle[ BUTTON_WORD( num ) ] |= BUTTON_BIT( num );
+
+                // Reset filter
+                if  (   ( eBUTTON_DEB_LPF == gp_cfg_table[num].deb_mode )
+                    &&  ( eFILTER_OK != filter_bool_reset( g_button[num].filt )))
+                {
+                    status = eBUTTON_ERROR;
+                }
             }
             else
             {
-                in = false;
+                status = eBUTTON_ERROR;
             }
+        }
+        else
+        {
+            status = eBUTTON_ERROR_INIT;
+        }
 
-            // Update filter
-            (void) filter_bool_hndl( g_button[num].filt, in, &out );
+        return status;
+    }
 
-            // Convert state
-            if ( true == out )
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Change button filter cutoff frequency
+    *
+    * @brief    LPF is RC 1st order IIR filter. Output is being compared between
+    *           5% and 95% (3 Tao).
+    *
+    *           E.g. LPF with fc=1Hz will result in button detection time delay
+    *           of:
+    *
+    *                 fc = 1 / ( 2*pi*Tao ) ---> Tao = 1 / ( 2*pi*fc )
+    *
+    *                 dt = 3 Tao = 3 * 1 / ( 2*pi*fc )
+    *
+    *                 fc = 1.0 Hz ---> dt = 0.477 sec
+    *
+    *
+    * @param[in]    num     - Button enumeration number
+    * @param[in]    fc      - Filter cutoff frequency
+    * @return       status  - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    button_status_t button_change_filter_fc(const button_num_t num, const float32_t fc)
+    {
+        button_status_t status = eBUTTON_OK;
+
+        BUTTON_ASSERT( true == gb_is_init );
+        BUTTON_ASSERT( num < eBUTTON_NUM_OF );
+        BUTTON_ASSERT( true == gp_cfg_table[num].lpf_en );
+        BUTTON_ASSERT( eBUTTON_DEB_LPF == gp_cfg_table[num].deb_mode );
+
+        if ( true == gb_is_init )
+        {
+            if  (   ( num < eBUTTON_NUM_OF )
+                &&  ( true == gp_cfg_table[num].lpf_en )
+                &&  ( eBUTTON_DEB_LPF == gp_cfg_table[num].deb_mode ))
+            {
+                // Change cutoff frequency
+                if ( eFILTER_OK != filter_bool_fc_set( g_button[num].filt, fc ))
+                {
+                    status = eBUTTON_ERROR;
+                }
+                else
+                {
+                    // Filter shall settle to new time constant
+                    g_button[num].deb.press = button_lpf_settle_time( num, fc );
+                    g_button[num].deb.cnt   = 0U;
+                    g_settle[ BUTTON_WORD( num ) ] |= BUTTON_BIT( num );
+                }
+            }
+            else
+            {
+                status = eBUTTON_ERROR;
+            }
+        }
+        else
+        {
+            status = eBUTTON_ERROR_INIT;
+        }
+
+        return status;
+    }
+
+#endif
+
+#if ( 1 == BUTTON_CFG_STATS_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Get button statistics
+    *
+    * @note     Active time is accounted at button release.
+    *
+    * @param[in]    num     - Button enumeration number
+    * @param[out]   p_stats - Pointer to button statistics
+    * @return       status  - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    button_status_t button_get_stats(const button_num_t num, button_stats_t * const p_stats)
+    {
+        button_status_t status = eBUTTON_OK;
+
+        BUTTON_ASSERT( true == gb_is_init );
+        BUTTON_ASSERT( num < eBUTTON_NUM_OF );
+        BUTTON_ASSERT( NULL != p_stats );
+
+        if ( true == gb_is_init )
+        {
+            if  (   ( num < eBUTTON_NUM_OF )
+                &&  ( NULL != p_stats ))
             {
-                state_filt = eBUTTON_ON;
+                *p_stats = g_stats.btn[num];
             }
             else
             {
-                state_filt = eBUTTON_OFF;
+                status = eBUTTON_ERROR;
             }
         }
-
-        // Filter disabled
         else
-    #endif
         {
-            state_filt = state;
+            status = eBUTTON_ERROR_INIT;
         }
 
-    return state_filt;
-}
+        return status;
+    }
 
-////////////////////////////////////////////////////////////////////////////////
-/**
-*       Manage button callbacks
-*
-* @note     If button is disabled, callbacks will not be triggered!
-*
-* @param[in]    num         - Button enumeration number
-* @param[in]    state_cur   - Current state of button
-* @param[in]    state_prev  - Previous state of button
-* @return       status      - Status of operation
-*/
-////////////////////////////////////////////////////////////////////////////////
-static void button_raise_callback(const button_num_t num, const button_state_t state_cur, button_state_t state_prev)
-{
-    // Is button enabled
-    if ( true == g_button[num].enable )
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Reset button statistics
+    *
+    * @note     E.g. after replacement of end-switch. Reset is stored to NVM
+    *           with next statistics flush.
+    *
+    * @param[in]    num     - Button enumeration number
+    * @return       status  - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    button_status_t button_reset_stats(const button_num_t num)
     {
-        if     (    ( NULL != g_button[num].pressed )
-            &&     ( eBUTTON_ON  == state_cur )
-            &&     ( eBUTTON_OFF == state_prev ))
-        {
-            g_button[num].pressed();
-        }
+        button_status_t status = eBUTTON_OK;
 
-        if     (    ( NULL != g_button[num].released )
-            &&     ( eBUTTON_OFF == state_cur )
-            &&     ( eBUTTON_ON  == state_prev ))
-        {
-            g_button[num].released();
-        }
-    }
-}
+        BUTTON_ASSERT( true == gb_is_init );
+        BUTTON_ASSERT( num < eBUTTON_NUM_OF );
 
-////////////////////////////////////////////////////////////////////////////////
-/**
-*       Manage button timings
-*
-* @note     If button is disabled, timings will resets!
-*
-* @param[in]    num        - Button enumeration number
-* @param[in]    state    - Current state of button
-* @return       status     - Status of operation
-*/
-////////////////////////////////////////////////////////////////////////////////
-static void button_manage_timings(const button_num_t num, const button_state_t state)
-{
-    // Is button enabled
-    if ( true == g_button[num].enable )
-    { 
-        if ( eBUTTON_ON == state )
-        {
-            g_button[num].time.idle     = 0.0f;
-            g_button[num].time.active   += BUTTON_HNDL_PERIOD_S;
-            g_button[num].time.active   = BUTTON_LIM_TIME( g_button[num].time.active );
-        }
-        else if ( eBUTTON_OFF == state )
+        if ( true == gb_is_init )
         {
-            g_button[num].time.active   = 0.0f;
-            g_button[num].time.idle     += BUTTON_HNDL_PERIOD_S;
-            g_button[num].time.idle     = BUTTON_LIM_TIME( g_button[num].time.idle );
+            if ( num < eBUTTON_NUM_OF )
+            {
+                g_stats.btn[num].press_cnt  = 0U;
+                g_stats.btn[num].active_s   = 0U;
+                g_stats_rem[num]            = 0.0f;
+                g_stats_tick[num]           = g_tick;
+                g_stats_dirty++;
+            }
+            else
+            {
+                status = eBUTTON_ERROR;
+            }
         }
         else
         {
-            g_button[num].time.active   = 0.0f;
-            g_button[num].time.idle     = 0.0f;
+            status = eBUTTON_ERROR_INIT;
         }
-    }
-    else
-    {
-        g_button[num].time.active   = 0.0f;
-        g_button[num].time.idle     = 0.0f;
-    }
-}
-
-////////////////////////////////////////////////////////////////////////////////
-/*!
- * @} <!-- END GROUP -->
- */
-////////////////////////////////////////////////////////////////////////////////
 
-////////////////////////////////////////////////////////////////////////////////
-/**
-*@addtogroup BUTTON_API
-* @{ <!-- BEGIN GROUP -->
-*
-*     Following functions are part of API calls.
-*/
-////////////////////////////////////////////////////////////////////////////////
-
-////////////////////////////////////////////////////////////////////////////////
-/**
-*       Button initialization
-*
-* @return       status - Status of initialization
-*/
-////////////////////////////////////////////////////////////////////////////////
-button_status_t button_init(void)
-{
-    button_status_t status = eBUTTON_OK;
+        return status;
+    }
 
-    if ( false == gb_is_init )
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Store button statistics to NVM immediately
+    *
+    * @note     E.g. on power-down detection. Nothing is written if there are
+    *           no unstored events or active time.
+    *
+    * @return       status  - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    button_status_t button_stats_flush(void)
     {
-        // Get configuration table
-        gp_cfg_table = button_cfg_get_table();
+        button_status_t status = eBUTTON_OK;
 
-        if ( NULL != gp_cfg_table )
-        {
-            // Check low level drivers
-            if ( eBUTTON_OK == button_check_drv_init())
-            {
-                // Init internal button data
-                status = button_internal_init();
+        BUTTON_ASSERT( true == gb_is_init );
 
-                // Init success
-                if ( eBUTTON_OK == status )
-                {
-                    gb_is_init = true;
-                }
-            }
+        if ( true == gb_is_init )
+        {
+            button_stats_held();
 
-            // Low level drivers not initialised
-            else
+            if  (   ( g_stats_dirty > 0U )
+                ||  ( true == gb_stats_time ))
             {
-                BUTTON_PRINT( "BUTTON: Low level drivers not initialised error!" );
-                BUTTON_ASSERT( 0 );
-                status = eBUTTON_ERROR_INIT;
+                status = button_stats_store();
             }
         }
         else
         {
-            BUTTON_PRINT( "BUTTON: Low level drivers not initialised error!" );
-            BUTTON_ASSERT( 0 );
             status = eBUTTON_ERROR_INIT;
         }
-    }
-
-    return status;
-}
-
-////////////////////////////////////////////////////////////////////////////////
-/**
-*       Button de-nitialization
-*
-* @return       status - Status of de-init
-*/
-////////////////////////////////////////////////////////////////////////////////
-button_status_t button_deinit(void)
-{
-    button_status_t status = eBUTTON_OK;
 
-    if ( false == gb_is_init )
-    {
-        gb_is_init = false;
+        return status;
     }
 
-    return status;
-}
+#endif
 
-////////////////////////////////////////////////////////////////////////////////
-/**
-*       Get button initialisation state
-*
-* @param[out]   p_is_init   - Initialization state
-* @return       status      - Status of initialization
-*/
-////////////////////////////////////////////////////////////////////////////////
-button_status_t button_is_init(bool * const p_is_init)
-{
-    button_status_t status = eBUTTON_OK;
+#if ( 1 == BUTTON_CFG_RUNTIME_CFG_EN )
 
-    if ( NULL != p_is_init )
-    {
-        *p_is_init = gb_is_init;
-    }
-    else
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Publish new button configuration table
+    *
+    * @note     Table is copied and applied by handler at its next call. Only
+    *           buttons with changed configuration are set up again (state,
+    *           debouncer & filter), all other buttons keep their state.
+    *
+    * @note     Error is returned if previous configuration change is not yet
+    *           applied by handler. In that case try again later.
+    *
+    * @param[in]    p_table - Pointer to new configuration table
+    * @return       status  - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    button_status_t button_set_cfg_table(const button_cfg_t * const p_table)
     {
-        status = eBUTTON_ERROR;
-    }
-
-    return status;
-}
-
-////////////////////////////////////////////////////////////////////////////////
-/**
-*       Main button handler
-*
-*@note     This function shall be called with constant period of value
-*          set in "button_cfg.h" with macro "BUTTON_CFG_HNDL_PERIOD_S".
-*
-* @return       status - Status of operation
-*/
-////////////////////////////////////////////////////////////////////////////////
-button_status_t button_hndl(void)
-{
-    button_status_t status = eBUTTON_OK;
+        button_status_t status = eBUTTON_OK;
 
-    BUTTON_ASSERT( true == gb_is_init );
+        BUTTON_ASSERT( true == gb_is_init );
+        BUTTON_ASSERT( NULL != p_table );
 
-    if ( true == gb_is_init )
-    {
-        // For each button
-        for ( button_num_t num = 0; num < eBUTTON_NUM_OF; num++ )
+        if ( true == gb_is_init )
         {
-            // Get button state
-            const button_state_t state = button_get_low( num );
-
-            // Apply filter
-            g_button[num].state.cur = button_filter_update( num, state );
-
-            // Manage callbacks
-            button_raise_callback( num, g_button[num].state.cur, g_button[num].state.prev );
-
-            // Manage timings
-            button_manage_timings( num, g_button[num].state.cur );
+            if  (   ( NULL != p_table )
+                &&  ( false == gb_cfg_pending ))
+            {
+                memcpy( &g_cfg_buf[ g_cfg_idx ^ 1U ], p_table, sizeof( g_cfg_buf[0] ));
 
-            // Store current state
-            g_button[num].state.prev = g_button[num].state.cur;
+                // Publish to handler
+                gb_cfg_pending = true;
+            }
+            else
+            {
+                status = eBUTTON_ERROR;
+            }
+        }
+        else
+        {
+            status = eBUTTON_ERROR_INIT;
         }
-    }
-    else
-    {
-        status = eBUTTON_ERROR_INIT;
-    }
-
-    return status;
-}
-
-////////////////////////////////////////////////////////////////////////////////
-/**
-*       Get current button state
-*
-* @note In case button is disabled, "eBUTTON_UNKNOWN" is returned!
-*
-* @param[in]    num     - Button enumeration number
-* @param[out]   p_state - Pointer to current button state
-* @return       status  - Status of operation
-*/
-////////////////////////////////////////////////////////////////////////////////
-button_status_t button_get_state(const button_num_t num, button_state_t * const p_state)
-{
-    button_status_t status = eBUTTON_OK;
 
-    BUTTON_ASSERT( true == gb_is_init );
-    BUTTON_ASSERT( num < eBUTTON_NUM_OF );
-    BUTTON_ASSERT( NULL != p_state );
+        return status;
+    }
 
-    if ( true == gb_is_init )
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Publish new configuration of single button
+    *
+    * @note     Same rules as for "button_set_cfg_table()" applies.
+    *
+    * @param[in]    num     - Button enumeration number
+    * @param[in]    p_cfg   - Pointer to new button configuration
+    * @return       status  - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    button_status_t button_set_cfg(const button_num_t num, const button_cfg_t * const p_cfg)
     {
-        if ( true == g_button[num].enable )
+        button_status_t status = eBUTTON_OK;
+
+        BUTTON_ASSERT( true == gb_is_init );
+        BUTTON_ASSERT( num < eBUTTON_NUM_OF );
+        BUTTON_ASSERT( NULL != p_cfg );
+
+        if ( true == gb_is_init )
         {
             if  (   ( num < eBUTTON_NUM_OF )
-                &&  ( NULL != p_state ))
+                &&  ( NULL != p_cfg )
+                &&  ( false == gb_cfg_pending ))
             {
-                *p_state = g_button[num].state.cur;
+                // Start from active configuration
+                memcpy( &g_cfg_buf[ g_cfg_idx ^ 1U ], gp_cfg_table, sizeof( g_cfg_buf[0] ));
+                memcpy( &g_cfg_buf[ g_cfg_idx ^ 1U ][num], p_cfg, sizeof( button_cfg_t ));
+
+                // Publish to handler
+                gb_cfg_pending = true;
             }
             else
             {
@@ -579,71 +4133,64 @@ button_status_t button_get_state(const button_num_t num, button_state_t * const
         }
         else
         {
-            *p_state = eBUTTON_UNKNOWN;     
+            status = eBUTTON_ERROR_INIT;
         }
-    }
-    else
-    {
-        status = eBUTTON_ERROR_INIT;
-    }
 
-    return status;
-}
+        return status;
+    }
 
-////////////////////////////////////////////////////////////////////////////////
-/**
-*       Get button timings
-*
-* @param[in]    num             - Button enumeration number
-* @param[out]   p_active_time   - Pointer to button active time
-* @param[out]   p_idle_time     - Pointer to button idle time
-* @return       status          - Status of operation
-*/
-////////////////////////////////////////////////////////////////////////////////
-button_status_t button_get_time(const button_num_t num, float32_t * const p_active_time, float32_t * const p_idle_time)
-{
-    button_status_t status = eBUTTON_OK;
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Get active configuration of single button
+    *
+    * @param[in]    num     - Button enumeration number
+    * @param[out]   p_cfg   - Pointer to button configuration
+    * @return       status  - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    button_status_t button_get_cfg(const button_num_t num, button_cfg_t * const p_cfg)
+    {
+        button_status_t status = eBUTTON_OK;
 
-    BUTTON_ASSERT( true == gb_is_init );
-    BUTTON_ASSERT( num < eBUTTON_NUM_OF );
+        BUTTON_ASSERT( true == gb_is_init );
+        BUTTON_ASSERT( num < eBUTTON_NUM_OF );
+        BUTTON_ASSERT( NULL != p_cfg );
 
-    if ( true == gb_is_init )
-    {
-        if ( num < eBUTTON_NUM_OF )
+        if ( true == gb_is_init )
         {
-            if ( NULL != p_active_time )
+            if  (   ( num < eBUTTON_NUM_OF )
+                &&  ( NULL != p_cfg ))
             {
-                *p_active_time = g_button[num].time.active;
+                *p_cfg = gp_cfg_table[num];
             }
-
-            if ( NULL != p_idle_time )
+            else
             {
-                *p_idle_time = g_button[num].time.idle;
+                status = eBUTTON_ERROR;
             }
         }
         else
         {
-            status = eBUTTON_ERROR;
+            status = eBUTTON_ERROR_INIT;
         }
-    }
-    else
-    {
-        status = eBUTTON_ERROR_INIT;
+
+        return status;
     }
 
-    return status;
-}
+#endif
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*       Enable/Disable button reading
+*       Set virtual input state
+*
+* @note     Can be called from interrupt. State is sampled by handler and
+*           processed the same way as GPIO input.
 *
 * @param[in]    num     - Button enumeration number
-* @param[in]    enable  - Enable/Disable button reading
+* @param[in]    active  - Virtual input active (pressed)
 * @return       status  - Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
-button_status_t button_set_enable(const button_num_t num, const bool enable)
+button_status_t button_virt_set(const button_num_t num, const bool active)
 {
     button_status_t status = eBUTTON_OK;
 
@@ -652,9 +4199,21 @@ button_status_t button_set_enable(const button_num_t num, const bool enable)
 
     if ( true == gb_is_init )
     {
-        if ( num < eBUTTON_NUM_OF )
+        if  (   ( num < eBUTTON_NUM_OF )
+            &&  ( 0U != ( g_virt_mask[ BUTTON_WORD( num ) ] & BUTTON_BIT( num ))))
         {
-            g_button[num].enable = enable;
+            BUTTON_CFG_ENTER_CRITICAL();
+
+            if ( true == active )
+            {
+                g_virt[ BUTTON_WORD( num ) ] |= BUTTON_BIT( num );
+            }
+            else
+            {
+                g_virt[ BUTTON_WORD( num ) ] &= ~BUTTON_BIT( num );
+            }
+
+            BUTTON_CFG_EXIT_CRITICAL();
         }
         else
         {
@@ -671,27 +4230,32 @@ button_status_t button_set_enable(const button_num_t num, const bool enable)
 
 ////////////////////////////////////////////////////////////////////////////////
 /**
-*       Get enable button state
+*       Write multiple virtual inputs at once
 *
-* @param[in]    num         - Button enumeration number
-* @param[out]   p_enable    - State of enable button switch
-* @return       status      - Status of operation
+* @note     Can be called from interrupt. Bit "n" of word "w" belongs to
+*           button number "w * 32 + n". Bits of non-virtual buttons are
+*           ignored.
+*
+* @param[in]    word    - Bitmask word index
+* @param[in]    mask    - Bitmask of inputs to write
+* @param[in]    value   - Bitmask of input states, bit set when active
+* @return       status  - Status of operation
 */
 ////////////////////////////////////////////////////////////////////////////////
-button_status_t button_get_enable(const button_num_t num, bool * const p_enable)
+button_status_t button_virt_write(const uint32_t word, const uint32_t mask, const uint32_t value)
 {
     button_status_t status = eBUTTON_OK;
 
     BUTTON_ASSERT( true == gb_is_init );
-    BUTTON_ASSERT( num < eBUTTON_NUM_OF );
-    BUTTON_ASSERT( NULL != p_enable );
+    BUTTON_ASSERT( word < BUTTON_WORD_NUM );
 
     if ( true == gb_is_init )
     {
-        if  (   ( num < eBUTTON_NUM_OF )
-            &&  ( NULL != p_enable ))
+        if ( word < BUTTON_WORD_NUM )
         {
-            *p_enable = g_button[num].enable;
+            BUTTON_CFG_ENTER_CRITICAL();
+            g_virt[word] = (( g_virt[word] & ~mask ) | ( value & mask ));
+            BUTTON_CFG_EXIT_CRITICAL();
         }
         else
         {
@@ -706,111 +4270,229 @@ button_status_t button_get_enable(const button_num_t num, bool * const p_enable)
     return status;
 }
 
-////////////////////////////////////////////////////////////////////////////////
-/**
-*       Register button press and release callbacks
-*
-* @brief    It is allowed to pass NULL pointer for if only one callback
-*           functions is needed!
-*
-* @param[in]    num         - Button enumeration number
-* @param[in]    pf_pressed  - Pointer to pressed callback function
-* @param[in]    pf_released - Pointer to release callback function
-* @return       status      - Status of operation
-*/
-////////////////////////////////////////////////////////////////////////////////
-button_status_t button_register_callback(const button_num_t num, pf_button_callback pf_pressed, pf_button_callback pf_released)
-{
-    button_status_t status = eBUTTON_OK;
-
-    BUTTON_ASSERT( true == gb_is_init );
-    BUTTON_ASSERT( num < eBUTTON_NUM_OF );
+#if ( 1 == BUTTON_CFG_STREAM_EN )
 
-    if ( true == gb_is_init )
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Ingest batch of raw port samples
+    *
+    * @note     Each word is single sample of raw port (e.g. GPIO input
+    *           register copied by timer triggered DMA at fixed rate). All
+    *           port bits are debounced at once with bit-sliced counters, thus
+    *           cost per sample does not depend on number of inputs. Buttons
+    *           are touched only at debounced edges.
+    *
+    *           Call it from the same context as "button_hndl()". Timings of
+    *           stream inputs have handler resolution, while sample of last
+    *           edge is available via "button_stream_get_edge()".
+    *
+    * @param[in]    p_smp   - Pointer to raw port samples
+    * @param[in]    num_of  - Number of samples
+    * @return       status  - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    button_status_t button_stream_ingest(const uint32_t * const p_smp, const uint32_t num_of)
     {
-        if ( num < eBUTTON_NUM_OF )
+        button_status_t status = eBUTTON_OK;
+
+        BUTTON_ASSERT( true == gb_is_init );
+        BUTTON_ASSERT( NULL != p_smp );
+
+        if ( true == gb_is_init )
         {
-            // Checking for NULL at call
-            g_button[num].pressed   = pf_pressed;
-            g_button[num].released  = pf_released;
+            if ( NULL != p_smp )
+            {
+                for ( uint32_t i = 0U; i < num_of; i++ )
+                {
+                    const uint32_t x = (( p_smp[i] ^ g_stream_inv ) & g_stream_used );
+                    uint32_t delta  = 0U;
+                    uint32_t carry  = 0U;
+                    uint32_t done   = 0xFFFFFFFFU;
+
+                    // First sample of new inputs
+                    if ( 0U != g_stream_new )
+                    {
+                        const uint32_t init = g_stream_new;
+
+                        g_stream_deb = (( g_stream_deb & ~init ) | ( x & init ));
+                        g_stream_new = 0U;
+
+                        for ( uint32_t j = 0U; j < BUTTON_STREAM_CNT_BITS; j++ )
+                        {
+                            g_stream_cnt[j] &= ~init;
+                        }
+
+                        button_stream_edge( init );
+                    }
+
+                    // Restart counting where input equals debounced state
+                    delta = ( x ^ g_stream_deb );
+                    carry = delta;
 
+                    for ( uint32_t j = 0U; j < BUTTON_STREAM_CNT_BITS; j++ )
+                    {
+                        const uint32_t c = (( g_stream_cnt[j] & delta ) & carry );
+
+                        g_stream_cnt[j] = (( g_stream_cnt[j] & delta ) ^ carry );
+                        carry = c;
+
+                        // Counter equals debounce time
+                        done &= ( 0U != ( BUTTON_CFG_STREAM_DEB_NUM & ( 1U << j ))) ? g_stream_cnt[j] : ~g_stream_cnt[j];
+                    }
+
+                    done &= delta;
+
+                    // Debounced edges
+                    if ( 0U != done )
+                    {
+                        g_stream_deb ^= done;
+
+                        for ( uint32_t j = 0U; j < BUTTON_STREAM_CNT_BITS; j++ )
+                        {
+                            g_stream_cnt[j] &= ~done;
+                        }
+
+                        button_stream_edge( done );
+                    }
+
+                    g_stream_smp++;
+                }
+            }
+            else
+            {
+                status = eBUTTON_ERROR;
+            }
         }
         else
         {
-            status = eBUTTON_ERROR;
+            status = eBUTTON_ERROR_INIT;
         }
-    }
-    else
-    {
-        status = eBUTTON_ERROR_INIT;
-    }
 
-    return status;
-}
+        return status;
+    }
 
-////////////////////////////////////////////////////////////////////////////////
-/**
-*       Un-register button press and release callbacks
-*
-* @param[in]    num     - Button enumeration number
-* @return       status  - Status of operation
-*/
-////////////////////////////////////////////////////////////////////////////////
-button_status_t button_unregister_callback(const button_num_t num)
-{
-    button_status_t status = eBUTTON_OK;
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *       Get stream sample of last debounced edge
+    *
+    * @note     Samples are counted from initialization of module. Edge is
+    *           reported at sample, where debounce time elapsed.
+    *
+    * @param[in]    num         - Button enumeration number
+    * @param[out]   p_sample    - Pointer to stream sample of last edge
+    * @return       status      - Status of operation
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    button_status_t button_stream_get_edge(const button_num_t num, uint32_t * const p_sample)
+    {
+        button_status_t status = eBUTTON_OK;
 
-    BUTTON_ASSERT( true == gb_is_init );
-    BUTTON_ASSERT( num < eBUTTON_NUM_OF );
+        BUTTON_ASSERT( true == gb_is_init );
+        BUTTON_ASSERT( num < eBUTTON_NUM_OF );
+        BUTTON_ASSERT( NULL != p_sample );
 
-    if ( true == gb_is_init )
-    {
-        if ( num < eBUTTON_NUM_OF )
+        if ( true == gb_is_init )
         {
-            g_button[num].pressed   = NULL;
-            g_button[num].released  = NULL;
+            if  (   ( num < eBUTTON_NUM_OF )
+                &&  ( NULL != p_sample )
+                &&  ( 0U != ( g_stream_mask[ BUTTON_WORD( num ) ] & BUTTON_BIT( num ))))
+            {
+                *p_sample = g_stream_edge[ gp_cfg_table[num].stream_bit ];
+            }
+            else
+            {
+                status = eBUTTON_ERROR;
+            }
         }
         else
         {
-            status = eBUTTON_ERROR;
+            status = eBUTTON_ERROR_INIT;
         }
-    }
-    else
-    {
-        status = eBUTTON_ERROR_INIT;
+
+        return status;
     }
 
-    return status;
-}
+#endif
 
-#if ( 1 == BUTTON_CFG_FILTER_EN )
+#if ( 1 == BUTTON_CFG_SEQ_EN )
 
     ////////////////////////////////////////////////////////////////////////////////
     /**
-    *       Reset button de-bouncing filter
+    *       Register press sequence
     *
-    * @note     This function is recommended to be called after enabling
-    *           button reading back from disabled state!
+    * @note     Sequence automaton is rebuilt, thus call it from the same
+    *           context as "button_hndl()". Next press of sequence has to
+    *           come within step timeout after previous one, otherwise
+    *           recognizer starts over. Presses of buttons that are not part
+    *           of any sequence are ignored.
     *
-    * @param[in]    num     - Button enumeration number
-    * @return       status  - Status of operation
+    * @param[in]    p_btn       - Pointer to buttons to press
+    * @param[in]    len         - Sequence length
+    * @param[in]    timeout     - Step timeout. Unit: sec
+    * @param[in]    pf_done     - Completion callback
+    * @param[out]   p_id        - Pointer to sequence ID. Can be NULL
+    * @return       status      - Status of operation
     */
     ////////////////////////////////////////////////////////////////////////////////
-    button_status_t button_reset_filter(const button_num_t num)
+    button_status_t button_seq_register(const button_num_t * const p_btn, const uint32_t len, const float32_t timeout, pf_button_callback pf_done, uint32_t * const p_id)
     {
         button_status_t status = eBUTTON_OK;
 
         BUTTON_ASSERT( true == gb_is_init );
-        BUTTON_ASSERT( num < eBUTTON_NUM_OF );
+        BUTTON_ASSERT( NULL != p_btn );
+        BUTTON_ASSERT(( len > 0U ) && ( len <= BUTTON_CFG_SEQ_LEN_MAX ));
 
         if ( true == gb_is_init )
         {
-            if ( num < eBUTTON_NUM_OF )
+            uint32_t i = 0U;
+
+            // Find free slot
+            for ( i = 0U; i < BUTTON_CFG_SEQ_NUM; i++ )
             {
-                // Reset filter
-                if ( eFILTER_OK != filter_bool_reset( g_button[num].filt ))
+                if ( 0U == g_seq[i].len )
                 {
-                    status = eBUTTON_ERROR;
+                    break;
+                }
+            }
+
+            if  (   ( NULL != p_btn )
+                &&  ( len > 0U )
+                &&  ( len <= BUTTON_CFG_SEQ_LEN_MAX )
+                &&  ( i < BUTTON_CFG_SEQ_NUM ))
+            {
+                for ( uint32_t k = 0U; k < len; k++ )
+                {
+                    if ( p_btn[k] >= eBUTTON_NUM_OF )
+                    {
+                        status = eBUTTON_ERROR;
+                    }
+
+                    g_seq[i].btn[k] = p_btn[k];
+                }
+
+                if ( eBUTTON_OK == status )
+                {
+                    g_seq[i].len        = len;
+                    g_seq[i].timeout    = (uint32_t)( timeout / BUTTON_HNDL_PERIOD_S );
+                    g_seq[i].pf_done    = pf_done;
+
+                    // Compile automaton
+                    status = button_seq_build();
+
+                    if ( eBUTTON_OK == status )
+                    {
+                        if ( NULL != p_id )
+                        {
+                            *p_id = i;
+                        }
+                    }
+
+                    // Does not fit into automaton
+                    else
+                    {
+                        g_seq[i].len = 0U;
+                        (void) button_seq_build();
+                    }
                 }
             }
             else
@@ -828,44 +4510,25 @@ button_status_t button_unregister_callback(const button_num_t num)
 
     ////////////////////////////////////////////////////////////////////////////////
     /**
-    *       Change button filter cutoff frequency
-    *
-    * @brief    LPF is RC 1st order IIR filter. Output is being compared between
-    *           5% and 95% (3 Tao).
-    *
-    *           E.g. LPF with fc=1Hz will result in button detection time delay
-    *           of:
-    *
-    *                 fc = 1 / ( 2*pi*Tao ) ---> Tao = 1 / ( 2*pi*fc )
+    *       Un-register press sequence
     *
-    *                 dt = 3 Tao = 3 * 1 / ( 2*pi*fc )
-    *
-    *                 fc = 1.0 Hz ---> dt = 0.477 sec
-    *
-    *
-    * @param[in]    num     - Button enumeration number
-    * @param[in]    fc      - Filter cutoff frequency
+    * @param[in]    id      - Sequence ID
     * @return       status  - Status of operation
     */
     ////////////////////////////////////////////////////////////////////////////////
-    button_status_t button_change_filter_fc(const button_num_t num, const float32_t fc)
+    button_status_t button_seq_unregister(const uint32_t id)
     {
         button_status_t status = eBUTTON_OK;
 
         BUTTON_ASSERT( true == gb_is_init );
-        BUTTON_ASSERT( num < eBUTTON_NUM_OF );
-        BUTTON_ASSERT( true == gp_cfg_table[num].lpf_en );
+        BUTTON_ASSERT( id < BUTTON_CFG_SEQ_NUM );
 
         if ( true == gb_is_init )
         {
-            if  (   ( num < eBUTTON_NUM_OF )
-                &&  ( true == gp_cfg_table[num].lpf_en ))
+            if ( id < BUTTON_CFG_SEQ_NUM )
             {
-                // Change cutoff frequency
-                if ( eFILTER_OK != filter_bool_fc_set( g_button[num].filt, fc ))
-                {
-                    status = eBUTTON_ERROR;
-                }
+                g_seq[id].len = 0U;
+                status = button_seq_build();
             }
             else
             {
@@ -7,8 +7,8 @@
 * @brief    Button manipulations
 * @author   Ziga Miklosic
 * @email    ziga.miklosic@gmail.com
-* @date     08.11.2023
-* @version  V1.2.0
+* @date     18.10.2026
+* @version  V1.3.0
 */
 ////////////////////////////////////////////////////////////////////////////////
 /**
@@ -35,7 +35,7 @@
  *     Module version
  */
 #define BUTTON_VER_MAJOR        ( 1 )
-#define BUTTON_VER_MINOR        ( 2 )
+#define BUTTON_VER_MINOR        ( 3 )
 #define BUTTON_VER_DEVELOP      ( 0 )
 
 /**
@@ -63,6 +63,15 @@ typedef enum
  */
 typedef void(*pf_button_callback)(void);
 
+/**
+ *     Button statistics
+ */
+typedef struct
+{
+    uint32_t press_cnt;     /**<Number of presses */
+    uint32_t active_s;      /**<Cumulative active (pressed) time. Unit: sec */
+} button_stats_t;
+
 ////////////////////////////////////////////////////////////////////////////////
 // Functions
 ////////////////////////////////////////////////////////////////////////////////
@@ -76,12 +85,36 @@ button_status_t button_set_enable           (const button_num_t num, const bool
 button_status_t button_get_enable           (const button_num_t num, bool * const p_enable);
 button_status_t button_register_callback    (const button_num_t num, pf_button_callback pf_pressed, pf_button_callback pf_released);
 button_status_t button_unregister_callback  (const button_num_t num);
+button_status_t button_virt_set             (const button_num_t num, const bool active);
+button_status_t button_virt_write           (const uint32_t word, const uint32_t mask, const uint32_t value);
 
 #if ( 1 == BUTTON_CFG_FILTER_EN )
     button_status_t button_reset_filter     (const button_num_t num);
     button_status_t button_change_filter_fc (const button_num_t num, const float32_t fc);
 #endif
 
+#if ( 1 == BUTTON_CFG_RUNTIME_CFG_EN )
+    button_status_t button_set_cfg_table    (const button_cfg_t * const p_table);
+    button_status_t button_set_cfg          (const button_num_t num, const button_cfg_t * const p_cfg);
+    button_status_t button_get_cfg          (const button_num_t num, button_cfg_t * const p_cfg);
+#endif
+
+#if ( 1 == BUTTON_CFG_STATS_EN )
+    button_status_t button_get_stats        (const button_num_t num, button_stats_t * const p_stats);
+    button_status_t button_reset_stats      (const button_num_t num);
+    button_status_t button_stats_flush      (void);
+#endif
+
+#if ( 1 == BUTTON_CFG_STREAM_EN )
+    button_status_t button_stream_ingest    (const uint32_t * const p_smp, const uint32_t num_of);
+    button_status_t button_stream_get_edge  (const button_num_t num, uint32_t * const p_sample);
+#endif
+
+#if ( 1 == BUTTON_CFG_SEQ_EN )
+    button_status_t button_seq_register     (const button_num_t * const p_btn, const uint32_t len, const float32_t timeout, pf_button_callback pf_done, uint32_t * const p_id);
+    button_status_t button_seq_unregister   (const uint32_t id);
+#endif
+
 #endif // __BUTTON_H_
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,476 @@
+// Copyright (c) 2023 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @file     button_tlm.c
+* @brief    Button binary event telemetry
+* @author   Ziga Miklosic
+* @email    ziga.miklosic@gmail.com
+* @date     18.10.2026
+* @version  V1.3.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+ * @addtogroup BUTTON_TLM
+ * @{ <!-- BEGIN GROUP -->
+ *
+ *  Events are encoded directly into user buffer as single frame:
+ *
+ *      | SYNC | SEQ | LEN | BASE TICK (varint) | RECORDS ... | CRC-8 |
+ *
+ *  LEN is size of records in bytes. Each record is:
+ *
+ *      | EVT[7:5] NUM[4:0] | NUM-31 (varint, only if NUM=31) | DELTA TICK (varint) | DATA (varint, gesture/fault/drop only) |
+ *
+ *  DELTA TICK is time from previous record (from BASE TICK for first
+ *  record), thus typical press/release event takes only 2 bytes.
+ */
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "button_tlm.h"
+#include "button_tlm_priv.h"
+
+#if ( 1 == BUTTON_CFG_TLM_EN )
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *     Button number escape value inside record header
+ */
+#define BUTTON_TLM_NUM_ESC                  ( 31U )
+
+/**
+ *     Position of LEN field inside frame
+ */
+#define BUTTON_TLM_LEN_POS                  ( 2U )
+
+/**
+ *     Telemetry encoder data
+ */
+typedef struct
+{
+    uint8_t *   p_buf;      /**<Frame buffer */
+    uint32_t    size;       /**<Size of frame buffer */
+    uint32_t    idx;        /**<Write index */
+    uint32_t    payload;    /**<Start of payload */
+    uint32_t    tick;       /**<Timestamp of last record */
+    uint32_t    drop;       /**<Number of dropped events */
+    uint8_t     seq;        /**<Frame sequence number */
+    bool        open;       /**<Frame opened */
+} button_tlm_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *     Telemetry encoder
+ */
+static button_tlm_t g_tlm = { 0 };
+
+////////////////////////////////////////////////////////////////////////////////
+// Function Prototypes
+////////////////////////////////////////////////////////////////////////////////
+static void     button_tlm_put_varint   (uint32_t value);
+static bool     button_tlm_get_varint   (const uint8_t * const p_data, const uint32_t size, uint32_t * const p_idx, uint32_t * const p_value);
+static void     button_tlm_open         (const uint32_t tick);
+static uint8_t  button_tlm_crc          (const uint8_t * const p_data, const uint32_t size);
+static bool     button_tlm_parse        (const uint8_t * const p_frame, const uint32_t size, uint32_t idx, uint32_t tick, pf_button_tlm_rec_t pf_rec);
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Write unsigned LEB128 variable length integer
+*
+* @note     Space is checked by caller.
+*
+* @param[in]    value   - Value to write
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void button_tlm_put_varint(uint32_t value)
+{
+    while ( value >= 0x80U )
+    {
+        g_tlm.p_buf[ g_tlm.idx++ ] = (uint8_t)( value | 0x80U );
+        value >>= 7U;
+    }
+
+    g_tlm.p_buf[ g_tlm.idx++ ] = (uint8_t) value;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Read unsigned LEB128 variable length integer
+*
+* @param[in]    p_data  - Pointer to data
+* @param[in]    size    - Size of data
+* @param[in]    p_idx   - Read index, advanced by number of read bytes
+* @param[out]   p_value - Read value
+* @return       true if value is valid
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool button_tlm_get_varint(const uint8_t * const p_data, const uint32_t size, uint32_t * const p_idx, uint32_t * const p_value)
+{
+    bool        is_ok   = false;
+    uint32_t    value   = 0U;
+
+    for ( uint32_t shift = 0U; ( *p_idx < size ) && ( shift < 32U ); shift += 7U )
+    {
+        const uint8_t byte = p_data[ (*p_idx)++ ];
+
+        value |= ((uint32_t)( byte & 0x7FU ) << shift );
+
+        if ( 0U == ( byte & 0x80U ))
+        {
+            is_ok = true;
+            break;
+        }
+    }
+
+    *p_value = value;
+
+    return is_ok;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Open new frame
+*
+* @param[in]    tick    - Timestamp of first record
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void button_tlm_open(const uint32_t tick)
+{
+    g_tlm.idx = 0U;
+    g_tlm.p_buf[ g_tlm.idx++ ] = BUTTON_TLM_SYNC;
+    g_tlm.p_buf[ g_tlm.idx++ ] = g_tlm.seq;
+    g_tlm.p_buf[ g_tlm.idx++ ] = 0U;
+    button_tlm_put_varint( tick );
+
+    g_tlm.payload   = g_tlm.idx;
+    g_tlm.tick      = tick;
+    g_tlm.open      = true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Calculate frame checksum
+*
+* @note     CRC-8, polynomial 0x07, initial value 0x00.
+*
+* @param[in]    p_data  - Pointer to data
+* @param[in]    size    - Size of data
+* @return       crc     - Checksum
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint8_t button_tlm_crc(const uint8_t * const p_data, const uint32_t size)
+{
+    uint8_t crc = 0U;
+
+    for ( uint32_t i = 0U; i < size; i++ )
+    {
+        crc ^= p_data[i];
+
+        for ( uint8_t b = 0U; b < 8U; b++ )
+        {
+            crc = ( 0U != ( crc & 0x80U )) ? (uint8_t)(( crc << 1U ) ^ 0x07U ) : (uint8_t)( crc << 1U );
+        }
+    }
+
+    return crc;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Parse records of telemetry frame
+*
+* @note     Without callback records are only checked, thus whole frame can
+*           be validated before first record is reported.
+*
+* @param[in]    p_frame - Pointer to frame
+* @param[in]    size    - Size of frame
+* @param[in]    idx     - Index of first record
+* @param[in]    tick    - Base tick of frame
+* @param[in]    pf_rec  - Callback for each decoded record. Can be NULL
+* @return       true if all records are valid
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool button_tlm_parse(const uint8_t * const p_frame, const uint32_t size, uint32_t idx, uint32_t tick, pf_button_tlm_rec_t pf_rec)
+{
+    const uint32_t  end     = ( size - BUTTON_TLM_CRC_SIZE );
+    bool            is_ok   = true;
+
+    while (( idx < end ) && ( true == is_ok ))
+    {
+        button_tlm_rec_t    rec     = { 0 };
+        uint32_t            delta   = 0U;
+
+        rec.evt = (button_tlm_evt_t)( p_frame[idx] >> 5U );
+        rec.num = ( p_frame[idx] & 0x1FU );
+        idx++;
+
+        if ( BUTTON_TLM_NUM_ESC == rec.num )
+        {
+            is_ok = button_tlm_get_varint( p_frame, end, &idx, &rec.num );
+            rec.num += BUTTON_TLM_NUM_ESC;
+        }
+
+        is_ok = ( is_ok && button_tlm_get_varint( p_frame, end, &idx, &delta ));
+        tick += delta;
+        rec.tick = tick;
+
+        if ( rec.evt >= eBUTTON_TLM_EVT_GESTURE )
+        {
+            is_ok = ( is_ok && button_tlm_get_varint( p_frame, end, &idx, &rec.data ));
+        }
+
+        is_ok = ( is_ok && ( rec.evt < eBUTTON_TLM_EVT_NUM_OF ));
+
+        if  (   ( true == is_ok )
+            &&  ( NULL != pf_rec ))
+        {
+            pf_rec( &rec );
+        }
+    }
+
+    return is_ok;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+ * @} <!-- END GROUP -->
+ */
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup BUTTON_TLM_API
+* @{ <!-- BEGIN GROUP -->
+*
+*     Following functions are part of API calls.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Put event to telemetry frame
+*
+* @note     Called by Button module. If there is no buffer or buffer is full,
+*           event is dropped and number of dropped events is reported
+*           inside next frame.
+*
+* @param[in]    evt     - Event
+* @param[in]    num     - Button enumeration number
+* @param[in]    tick    - Timestamp. Unit: handler ticks
+* @param[in]    data    - Event data (gesture, fault & drop events only)
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void button_tlm_put(const button_tlm_evt_t evt, const uint32_t num, const uint32_t tick, const uint32_t data)
+{
+    if ( NULL != g_tlm.p_buf )
+    {
+        if ( false == g_tlm.open )
+        {
+            button_tlm_open( tick );
+
+            // Report dropped events first
+            if ( g_tlm.drop > 0U )
+            {
+                const uint32_t drop = g_tlm.drop;
+
+                g_tlm.drop = 0U;
+                button_tlm_put( eBUTTON_TLM_EVT_DROP, 0U, tick, drop );
+            }
+        }
+
+        // Enough space for worst case record?
+        if  (   (( g_tlm.idx + BUTTON_TLM_REC_SIZE_MAX + BUTTON_TLM_CRC_SIZE ) <= g_tlm.size )
+            &&  (( g_tlm.idx - g_tlm.payload + BUTTON_TLM_REC_SIZE_MAX ) <= BUTTON_TLM_PAYLOAD_SIZE_MAX ))
+        {
+            g_tlm.p_buf[ g_tlm.idx++ ] = (uint8_t)(((uint32_t) evt << 5U ) | (( num < BUTTON_TLM_NUM_ESC ) ? num : BUTTON_TLM_NUM_ESC ));
+
+            if ( num >= BUTTON_TLM_NUM_ESC )
+            {
+                button_tlm_put_varint( num - BUTTON_TLM_NUM_ESC );
+            }
+
+            button_tlm_put_varint( tick - g_tlm.tick );
+            g_tlm.tick = tick;
+
+            if ( evt >= eBUTTON_TLM_EVT_GESTURE )
+            {
+                button_tlm_put_varint( data );
+            }
+        }
+        else
+        {
+            g_tlm.drop++;
+        }
+    }
+    else
+    {
+        g_tlm.drop++;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Set telemetry frame buffer
+*
+* @note     Events are encoded directly into that buffer, so it can be sent
+*           out (e.g. via DMA) without copying. Use two buffers alternately
+*           to record new events while previous frame is being sent.
+*
+* @note     Buffer shall be at least BUTTON_TLM_HEAD_SIZE_MAX +
+*           BUTTON_TLM_REC_SIZE_MAX + BUTTON_TLM_CRC_SIZE bytes big.
+*
+* @param[in]    p_buf   - Pointer to frame buffer
+* @param[in]    size    - Size of frame buffer
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+button_status_t button_tlm_set_buf(uint8_t * const p_buf, const uint32_t size)
+{
+    button_status_t status = eBUTTON_OK;
+
+    BUTTON_ASSERT( NULL != p_buf );
+    BUTTON_ASSERT( size >= ( BUTTON_TLM_HEAD_SIZE_MAX + BUTTON_TLM_REC_SIZE_MAX + BUTTON_TLM_CRC_SIZE ));
+
+    if  (   ( NULL != p_buf )
+        &&  ( size >= ( BUTTON_TLM_HEAD_SIZE_MAX + BUTTON_TLM_REC_SIZE_MAX + BUTTON_TLM_CRC_SIZE )))
+    {
+        g_tlm.p_buf = p_buf;
+        g_tlm.size  = size;
+        g_tlm.idx   = 0U;
+        g_tlm.open  = false;
+    }
+    else
+    {
+        status = eBUTTON_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Close telemetry frame
+*
+* @note     Frame is located inside buffer set by "button_tlm_set_buf()".
+*           Buffer is released from encoder, thus new buffer shall be set in
+*           order to record further events.
+*
+* @note     Shall be called from the same context as "button_hndl()".
+*
+* @param[out]   pp_frame    - Pointer to frame
+* @param[out]   p_size      - Size of frame. Zero if there are no events.
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+button_status_t button_tlm_flush(const uint8_t ** const pp_frame, uint32_t * const p_size)
+{
+    button_status_t status = eBUTTON_OK;
+
+    BUTTON_ASSERT( NULL != pp_frame );
+    BUTTON_ASSERT( NULL != p_size );
+
+    if  (   ( NULL != pp_frame )
+        &&  ( NULL != p_size ))
+    {
+        *pp_frame   = g_tlm.p_buf;
+        *p_size     = 0U;
+
+        if ( true == g_tlm.open )
+        {
+            // Complete header
+            g_tlm.p_buf[ BUTTON_TLM_LEN_POS ] = (uint8_t)( g_tlm.idx - g_tlm.payload );
+
+            // Append checksum
+            g_tlm.p_buf[ g_tlm.idx ] = button_tlm_crc( g_tlm.p_buf, g_tlm.idx );
+            g_tlm.idx++;
+
+            *p_size = g_tlm.idx;
+            g_tlm.seq++;
+        }
+
+        // Release buffer
+        g_tlm.p_buf = NULL;
+        g_tlm.size  = 0U;
+        g_tlm.idx   = 0U;
+        g_tlm.open  = false;
+    }
+    else
+    {
+        status = eBUTTON_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Decode telemetry frame
+*
+* @note     Intended for receiving side (e.g. host service tool). Frame is
+*           checked for integrity and all its records are parsed before any
+*           record is reported, thus malformed frame reports no records.
+*
+* @param[in]    p_frame - Pointer to frame
+* @param[in]    size    - Size of frame
+* @param[in]    pf_rec  - Callback for each decoded record
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+button_status_t button_tlm_decode(const uint8_t * const p_frame, const uint32_t size, pf_button_tlm_rec_t pf_rec)
+{
+    button_status_t status  = eBUTTON_OK;
+    uint32_t        idx     = ( BUTTON_TLM_LEN_POS + 1U );
+    uint32_t        tick    = 0U;
+
+    if  (   ( NULL == p_frame )
+        ||  ( NULL == pf_rec )
+        ||  ( size < ( BUTTON_TLM_LEN_POS + 2U + BUTTON_TLM_CRC_SIZE ))
+        ||  ( BUTTON_TLM_SYNC != p_frame[0] )
+        ||  ( button_tlm_crc( p_frame, size - BUTTON_TLM_CRC_SIZE ) != p_frame[ size - BUTTON_TLM_CRC_SIZE ] )
+        ||  ( false == button_tlm_get_varint( p_frame, size, &idx, &tick ))
+        ||  (( idx + p_frame[ BUTTON_TLM_LEN_POS ] + BUTTON_TLM_CRC_SIZE ) != size ))
+    {
+        status = eBUTTON_ERROR;
+    }
+
+    // Validate all records first, then report them
+    else if ( true == button_tlm_parse( p_frame, size, idx, tick, NULL ))
+    {
+        (void) button_tlm_parse( p_frame, size, idx, tick, pf_rec );
+    }
+    else
+    {
+        status = eBUTTON_ERROR;
+    }
+
+    return status;
+}
+
+#endif // ( 1 == BUTTON_CFG_TLM_EN )
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+ * @} <!-- END GROUP -->
+ */
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,129 @@
+// Copyright (c) 2023 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @file     button_tlm.h
+* @brief    Button binary event telemetry
+* @author   Ziga Miklosic
+* @email    ziga.miklosic@gmail.com
+* @date     18.10.2026
+* @version  V1.3.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @addtogroup BUTTON_TLM_API
+* @{ <!-- BEGIN GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+#ifndef __BUTTON_TLM_H_
+#define __BUTTON_TLM_H_
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "button.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *     Telemetry frame sync byte
+ */
+#define BUTTON_TLM_SYNC                 ( 0xB7U )
+
+/**
+ *     Telemetry frame header & checksum size
+ *
+ *     Unit: byte
+ */
+#define BUTTON_TLM_HEAD_SIZE_MAX        ( 8U )
+#define BUTTON_TLM_CRC_SIZE             ( 1U )
+
+/**
+ *     Maximum size of telemetry event record
+ *
+ *     Unit: byte
+ */
+#define BUTTON_TLM_REC_SIZE_MAX         ( 16U )
+
+/**
+ *     Maximum size of telemetry frame payload
+ *
+ *     Unit: byte
+ */
+#define BUTTON_TLM_PAYLOAD_SIZE_MAX     ( 255U )
+
+/**
+ *     Telemetry event
+ */
+typedef enum
+{
+    eBUTTON_TLM_EVT_PRESS = 0,  /**<Button pressed */
+    eBUTTON_TLM_EVT_RELEASE,    /**<Button released */
+    eBUTTON_TLM_EVT_GESTURE,    /**<Gesture detected, data is gesture specific */
+    eBUTTON_TLM_EVT_FAULT,      /**<Fault detected, data is fault code */
+    eBUTTON_TLM_EVT_DROP,       /**<Events dropped due to full buffer, data is number of dropped events */
+
+    eBUTTON_TLM_EVT_NUM_OF
+} button_tlm_evt_t;
+
+/**
+ *     Telemetry fault codes
+ */
+typedef enum
+{
+    eBUTTON_TLM_FAULT_GPIO = 0, /**<GPIO state unknown */
+} button_tlm_fault_t;
+
+/**
+ *     Telemetry gesture codes
+ *
+ * @note    Gesture event data holds gesture code in lower 4 bits and gesture
+ *          value in upper bits, see BUTTON_TLM_GESTURE_DATA.
+ */
+typedef enum
+{
+    eBUTTON_TLM_GESTURE_REPEAT = 0, /**<Auto-repeat of held button, value is repeat count */
+    eBUTTON_TLM_GESTURE_SEQUENCE,   /**<Press sequence completed at button, value is sequence ID */
+} button_tlm_gesture_t;
+
+/**
+ *     Gesture event data
+ */
+#define BUTTON_TLM_GESTURE_DATA( code, value )  (((uint32_t)( value ) << 4U ) | ((uint32_t)( code ) & 0x0FU ))
+
+/**
+ *     Decoded telemetry record
+ */
+typedef struct
+{
+    button_tlm_evt_t    evt;    /**<Event */
+    uint32_t            num;    /**<Button enumeration number */
+    uint32_t            tick;   /**<Timestamp. Unit: handler ticks */
+    uint32_t            data;   /**<Event data (gesture, fault & drop events only) */
+} button_tlm_rec_t;
+
+/**
+ *     Decoded record callback
+ */
+typedef void(*pf_button_tlm_rec_t)(const button_tlm_rec_t * const p_rec);
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+button_status_t button_tlm_set_buf  (uint8_t * const p_buf, const uint32_t size);
+button_status_t button_tlm_flush    (const uint8_t ** const pp_frame, uint32_t * const p_size);
+button_status_t button_tlm_decode   (const uint8_t * const p_frame, const uint32_t size, pf_button_tlm_rec_t pf_rec);
+
+#endif // __BUTTON_TLM_H_
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,43 @@
+// Copyright (c) 2023 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @file     button_tlm_priv.h
+* @brief    Button binary event telemetry - internal interface
+* @author   Ziga Miklosic
+* @email    ziga.miklosic@gmail.com
+* @date     18.10.2026
+* @version  V1.3.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @addtogroup BUTTON_TLM
+* @{ <!-- BEGIN GROUP -->
+*
+*     Event encoder used by Button module only. Not part of API, so that
+*     application cannot put events into telemetry stream.
+*/
+////////////////////////////////////////////////////////////////////////////////
+#ifndef __BUTTON_TLM_PRIV_H_
+#define __BUTTON_TLM_PRIV_H_
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+
+#include "button_tlm.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+void button_tlm_put(const button_tlm_evt_t evt, const uint32_t num, const uint32_t tick, const uint32_t data);
+
+#endif // __BUTTON_TLM_PRIV_H_
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
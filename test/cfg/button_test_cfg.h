@@ -0,0 +1,57 @@
+// Copyright (c) 2023 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @file     button_test_cfg.h
+* @brief    Button list & configuration overrides for runtime configuration test
+* @author   Ziga Miklosic
+* @email    ziga.miklosic@gmail.com
+* @date     18.10.2026
+* @version  V1.3.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @addtogroup BUTTON_CFG
+* @{ <!-- BEGIN GROUP -->
+*
+*     Included by base test configuration (test/common/button_cfg.h).
+*
+*/
+////////////////////////////////////////////////////////////////////////////////
+#ifndef __BUTTON_TEST_CFG_H_
+#define __BUTTON_TEST_CFG_H_
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *     List of Buttons
+ */
+typedef enum
+{
+    eBUTTON_TEST_0 = 0,         /**<GPIO, active high */
+    eBUTTON_TEST_1,             /**<GPIO, active low */
+    eBUTTON_TEST_2,             /**<GPIO, sampled at each second call */
+    eBUTTON_TEST_3,             /**<Virtual input */
+    eBUTTON_TEST_4,             /**<Stream bit 3 */
+    eBUTTON_TEST_5,             /**<Stream bit 4 */
+
+    eBUTTON_NUM_OF
+} button_num_t;
+
+/**
+ *     Configuration overrides
+ */
+#define BUTTON_CFG_RUNTIME_CFG_EN           ( 1 )
+#define BUTTON_CFG_STREAM_EN                ( 1 )
+#define BUTTON_CFG_STREAM_DEB_NUM           ( 4U )
+
+#endif // __BUTTON_TEST_CFG_H_
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
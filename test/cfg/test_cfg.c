@@ -0,0 +1,530 @@
+// Copyright (c) 2023 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @file     test_cfg.c
+* @brief    Runtime configuration change test
+* @author   Ziga Miklosic
+* @email    ziga.miklosic@gmail.com
+* @date     18.10.2026
+* @version  V1.3.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @addtogroup BUTTON_TEST
+* @{ <!-- BEGIN GROUP -->
+*
+*   Configuration is changed at runtime and checked to take effect at next
+*   handler call, to keep state of other buttons, to move button between
+*   GPIO, virtual and stream source, to swap stream bits between buttons,
+*   to reject second change while first one is pending and to be restored
+*   by re-initialization.
+*
+*   Usage: test_cfg
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "button/src/button.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *     Settle time of inputs
+ *
+ *     Unit: handler calls
+ */
+#define TEST_SETTLE_TICK                    ( 10U )
+
+/**
+ *     Check condition and report failure
+ */
+#define TEST_CHECK( cond )                                                          \
+    do                                                                              \
+    {                                                                               \
+        if ( !( cond ))                                                             \
+        {                                                                           \
+            printf( "%s:%d: check failed: %s\n", __func__, __LINE__, #cond );       \
+            gb_is_ok = false;                                                       \
+        }                                                                           \
+    } while ( 0 )
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *     Test result
+ */
+static bool gb_is_ok = true;
+
+/**
+ *     Number of callbacks of button 1
+ */
+static uint32_t g_pressed_cnt   = 0U;
+static uint32_t g_released_cnt  = 0U;
+
+////////////////////////////////////////////////////////////////////////////////
+// Function Prototypes
+////////////////////////////////////////////////////////////////////////////////
+static void             test_pressed    (void);
+static void             test_released   (void);
+static void             test_run        (const uint32_t tick);
+static void             test_stream     (const uint32_t smp, const uint32_t num_of);
+static button_state_t   test_state      (const button_num_t num);
+static button_cfg_t     test_get_cfg    (const button_num_t num);
+static void             test_init       (void);
+static void             test_boundary   (void);
+static void             test_override   (void);
+static void             test_source     (void);
+static void             test_pending    (void);
+static void             test_swap       (void);
+static void             test_reinit     (void);
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Button 1 pressed
+*
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_pressed(void)
+{
+    g_pressed_cnt++;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Button 1 released
+*
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_released(void)
+{
+    g_released_cnt++;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Call button handler
+*
+* @param[in]    tick    - Number of handler calls
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_run(const uint32_t tick)
+{
+    for ( uint32_t i = 0U; i < tick; i++ )
+    {
+        (void) button_hndl();
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Pass the same raw port word multiple times
+*
+* @param[in]    smp     - Raw port word
+* @param[in]    num_of  - Number of samples
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_stream(const uint32_t smp, const uint32_t num_of)
+{
+    for ( uint32_t i = 0U; i < num_of; i++ )
+    {
+        TEST_CHECK( eBUTTON_OK == button_stream_ingest( &smp, 1U ));
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get button state
+*
+* @param[in]    num     - Button
+* @return       state   - State of button
+*/
+////////////////////////////////////////////////////////////////////////////////
+static button_state_t test_state(const button_num_t num)
+{
+    button_state_t state = eBUTTON_UNKNOWN;
+
+    TEST_CHECK( eBUTTON_OK == button_get_state( num, &state ));
+
+    return state;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get active button configuration
+*
+* @param[in]    num     - Button
+* @return       cfg     - Configuration of button
+*/
+////////////////////////////////////////////////////////////////////////////////
+static button_cfg_t test_get_cfg(const button_num_t num)
+{
+    button_cfg_t cfg = { 0 };
+
+    TEST_CHECK( eBUTTON_OK == button_get_cfg( num, &cfg ));
+
+    return cfg;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Release all inputs and initialize module
+*
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_init(void)
+{
+    gpio_stub_set( eGPIO_PIN_0, eGPIO_LOW );
+    gpio_stub_set( eGPIO_PIN_1, eGPIO_HIGH );
+    gpio_stub_set( eGPIO_PIN_2, eGPIO_LOW );
+
+    TEST_CHECK( eBUTTON_OK == button_init());
+    TEST_CHECK( eBUTTON_OK == button_register_callback( eBUTTON_TEST_1, test_pressed, test_released ));
+
+    test_stream( 0U, 1U );
+    test_run( TEST_SETTLE_TICK );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       New configuration takes effect at next handler call
+*
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_boundary(void)
+{
+    button_cfg_t cfg = { 0 };
+
+    test_init();
+
+    cfg = test_get_cfg( eBUTTON_TEST_0 );
+    cfg.deb_press = 0.1f;
+    TEST_CHECK( eBUTTON_OK == button_set_cfg( eBUTTON_TEST_0, &cfg ));
+
+    // Still old configuration
+    TEST_CHECK( 0.02f == test_get_cfg( eBUTTON_TEST_0 ).deb_press );
+
+    test_run( 1U );
+    TEST_CHECK( 0.1f == test_get_cfg( eBUTTON_TEST_0 ).deb_press );
+
+    test_run( TEST_SETTLE_TICK );
+    TEST_CHECK( eBUTTON_OFF == test_state( eBUTTON_TEST_0 ));
+
+    // Debounced with new press time
+    gpio_stub_set( eGPIO_PIN_0, eGPIO_HIGH );
+    test_run( 5U );
+    TEST_CHECK( eBUTTON_OFF == test_state( eBUTTON_TEST_0 ));
+    test_run( 6U );
+    TEST_CHECK( eBUTTON_ON == test_state( eBUTTON_TEST_0 ));
+
+    gpio_stub_set( eGPIO_PIN_0, eGPIO_LOW );
+    test_run( TEST_SETTLE_TICK );
+    TEST_CHECK( eBUTTON_OFF == test_state( eBUTTON_TEST_0 ));
+
+    TEST_CHECK( eBUTTON_OK == button_deinit());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Change of single button keeps state of other buttons
+*
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_override(void)
+{
+    button_cfg_t    cfg     = { 0 };
+    float32_t       active  = 0.0f;
+    float32_t       idle    = 0.0f;
+    float32_t       held    = 0.0f;
+
+    test_init();
+
+    g_pressed_cnt   = 0U;
+    g_released_cnt  = 0U;
+
+    // Press button 1
+    gpio_stub_set( eGPIO_PIN_1, eGPIO_LOW );
+    test_run( TEST_SETTLE_TICK );
+    TEST_CHECK( eBUTTON_ON == test_state( eBUTTON_TEST_1 ));
+    TEST_CHECK( eBUTTON_OK == button_get_time( eBUTTON_TEST_1, &active, &idle ));
+
+    // Change of debounce & sampling of button 0 (reschedule)
+    cfg = test_get_cfg( eBUTTON_TEST_0 );
+    cfg.deb_press   = 0.05f;
+    cfg.sample_div  = 3U;
+    TEST_CHECK( eBUTTON_OK == button_set_cfg( eBUTTON_TEST_0, &cfg ));
+    test_run( TEST_SETTLE_TICK );
+
+    TEST_CHECK( eBUTTON_ON == test_state( eBUTTON_TEST_1 ));
+    TEST_CHECK( eBUTTON_OK == button_get_time( eBUTTON_TEST_1, &held, &idle ));
+    TEST_CHECK( held > ( active + 0.05f ));
+    TEST_CHECK( 1U == g_pressed_cnt );
+    TEST_CHECK( 0U == g_released_cnt );
+
+    // Whole table with button 1 unchanged
+    TEST_CHECK( eBUTTON_OK == button_set_cfg_table( button_cfg_get_table()));
+    test_run( TEST_SETTLE_TICK );
+
+    TEST_CHECK( eBUTTON_ON == test_state( eBUTTON_TEST_1 ));
+    TEST_CHECK( 1U == g_pressed_cnt );
+    TEST_CHECK( 0U == g_released_cnt );
+
+    gpio_stub_set( eGPIO_PIN_1, eGPIO_HIGH );
+    test_run( TEST_SETTLE_TICK );
+    TEST_CHECK( eBUTTON_OFF == test_state( eBUTTON_TEST_1 ));
+    TEST_CHECK( 1U == g_released_cnt );
+
+    TEST_CHECK( eBUTTON_OK == button_deinit());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Button moves between GPIO, virtual and stream source
+*
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_source(void)
+{
+    button_cfg_t cfg = { 0 };
+
+    test_init();
+
+    gpio_stub_set( eGPIO_PIN_2, eGPIO_HIGH );
+    test_run( TEST_SETTLE_TICK );
+    TEST_CHECK( eBUTTON_ON == test_state( eBUTTON_TEST_2 ));
+    TEST_CHECK( eBUTTON_ERROR == button_virt_set( eBUTTON_TEST_2, true ));
+
+    // GPIO -> virtual: GPIO pin is not read anymore
+    cfg = test_get_cfg( eBUTTON_TEST_2 );
+    cfg.source = eBUTTON_SRC_VIRTUAL;
+    TEST_CHECK( eBUTTON_OK == button_set_cfg( eBUTTON_TEST_2, &cfg ));
+    test_run( TEST_SETTLE_TICK );
+    TEST_CHECK( eBUTTON_OFF == test_state( eBUTTON_TEST_2 ));
+
+    TEST_CHECK( eBUTTON_OK == button_virt_set( eBUTTON_TEST_2, true ));
+    test_run( TEST_SETTLE_TICK );
+    TEST_CHECK( eBUTTON_ON == test_state( eBUTTON_TEST_2 ));
+
+    // Virtual -> stream bit 7
+    cfg.source      = eBUTTON_SRC_STREAM;
+    cfg.stream_bit  = 7U;
+    TEST_CHECK( eBUTTON_OK == button_set_cfg( eBUTTON_TEST_2, &cfg ));
+    test_run( 1U );
+    TEST_CHECK( eBUTTON_ERROR == button_virt_set( eBUTTON_TEST_2, false ));
+    TEST_CHECK( eBUTTON_UNKNOWN == test_state( eBUTTON_TEST_2 ));
+
+    test_stream( 0U, 1U );
+    TEST_CHECK( eBUTTON_OFF == test_state( eBUTTON_TEST_2 ));
+
+    test_stream(( 1U << 7U ), ( BUTTON_CFG_STREAM_DEB_NUM - 1U ));
+    TEST_CHECK( eBUTTON_OFF == test_state( eBUTTON_TEST_2 ));
+    test_stream(( 1U << 7U ), 1U );
+    TEST_CHECK( eBUTTON_ON == test_state( eBUTTON_TEST_2 ));
+
+    // Other stream inputs not affected
+    TEST_CHECK( eBUTTON_OFF == test_state( eBUTTON_TEST_4 ));
+    TEST_CHECK( eBUTTON_OFF == test_state( eBUTTON_TEST_5 ));
+
+    // Stream -> GPIO
+    cfg.source      = eBUTTON_SRC_GPIO;
+    cfg.stream_bit  = 0U;
+    TEST_CHECK( eBUTTON_OK == button_set_cfg( eBUTTON_TEST_2, &cfg ));
+    gpio_stub_set( eGPIO_PIN_2, eGPIO_LOW );
+    test_run( TEST_SETTLE_TICK );
+    TEST_CHECK( eBUTTON_OFF == test_state( eBUTTON_TEST_2 ));
+
+    // Stream bit 7 released
+    test_stream( 0U, BUTTON_CFG_STREAM_DEB_NUM );
+    TEST_CHECK( eBUTTON_OFF == test_state( eBUTTON_TEST_2 ));
+
+    gpio_stub_set( eGPIO_PIN_2, eGPIO_HIGH );
+    test_run( TEST_SETTLE_TICK );
+    TEST_CHECK( eBUTTON_ON == test_state( eBUTTON_TEST_2 ));
+
+    gpio_stub_set( eGPIO_PIN_2, eGPIO_LOW );
+    test_run( TEST_SETTLE_TICK );
+
+    TEST_CHECK( eBUTTON_OK == button_deinit());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Second change is rejected while first one is pending
+*
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_pending(void)
+{
+    button_cfg_t cfg_0 = { 0 };
+    button_cfg_t cfg_1 = { 0 };
+
+    test_init();
+
+    cfg_0 = test_get_cfg( eBUTTON_TEST_0 );
+    cfg_1 = test_get_cfg( eBUTTON_TEST_1 );
+    cfg_0.deb_release = 0.07f;
+    cfg_1.deb_release = 0.09f;
+
+    TEST_CHECK( eBUTTON_OK == button_set_cfg( eBUTTON_TEST_0, &cfg_0 ));
+    TEST_CHECK( eBUTTON_ERROR == button_set_cfg( eBUTTON_TEST_1, &cfg_1 ));
+    TEST_CHECK( eBUTTON_ERROR == button_set_cfg_table( button_cfg_get_table()));
+
+    // Only first change is applied
+    test_run( 1U );
+    TEST_CHECK( 0.07f == test_get_cfg( eBUTTON_TEST_0 ).deb_release );
+    TEST_CHECK( 0.02f == test_get_cfg( eBUTTON_TEST_1 ).deb_release );
+
+    // Accepted again after it is applied
+    TEST_CHECK( eBUTTON_OK == button_set_cfg( eBUTTON_TEST_1, &cfg_1 ));
+    test_run( 1U );
+    TEST_CHECK( 0.07f == test_get_cfg( eBUTTON_TEST_0 ).deb_release );
+    TEST_CHECK( 0.09f == test_get_cfg( eBUTTON_TEST_1 ).deb_release );
+
+    TEST_CHECK( eBUTTON_OK == button_deinit());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Stream bits are swapped between buttons
+*
+* @note     Lower button takes bit still used by higher button.
+*
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_swap(void)
+{
+    button_cfg_t table[eBUTTON_NUM_OF];
+
+    test_init();
+
+    for ( button_num_t num = 0; num < eBUTTON_NUM_OF; num++ )
+    {
+        table[num] = test_get_cfg( num );
+    }
+
+    table[eBUTTON_TEST_4].stream_bit = 4U;
+    table[eBUTTON_TEST_5].stream_bit = 3U;
+
+    TEST_CHECK( eBUTTON_OK == button_set_cfg_table( table ));
+    test_run( 1U );
+
+    TEST_CHECK( 4U == test_get_cfg( eBUTTON_TEST_4 ).stream_bit );
+    TEST_CHECK( 3U == test_get_cfg( eBUTTON_TEST_5 ).stream_bit );
+
+    // Bit 4
+    test_stream(( 1U << 4U ), 1U );
+    TEST_CHECK( eBUTTON_ON == test_state( eBUTTON_TEST_4 ));
+    TEST_CHECK( eBUTTON_OFF == test_state( eBUTTON_TEST_5 ));
+
+    // Bit 3
+    test_stream(( 1U << 3U ), BUTTON_CFG_STREAM_DEB_NUM );
+    TEST_CHECK( eBUTTON_OFF == test_state( eBUTTON_TEST_4 ));
+    TEST_CHECK( eBUTTON_ON == test_state( eBUTTON_TEST_5 ));
+
+    test_stream( 0U, BUTTON_CFG_STREAM_DEB_NUM );
+    TEST_CHECK( eBUTTON_OFF == test_state( eBUTTON_TEST_5 ));
+
+    TEST_CHECK( eBUTTON_OK == button_deinit());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Re-initialization restores configuration table
+*
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_reinit(void)
+{
+    const button_cfg_t * const p_table = button_cfg_get_table();
+    button_cfg_t cfg = { 0 };
+
+    test_init();
+
+    // Applied change
+    cfg = test_get_cfg( eBUTTON_TEST_3 );
+    cfg.deb_press = 0.05f;
+    TEST_CHECK( eBUTTON_OK == button_set_cfg( eBUTTON_TEST_3, &cfg ));
+    test_run( 1U );
+
+    TEST_CHECK( eBUTTON_OK == button_virt_set( eBUTTON_TEST_3, true ));
+    test_run( TEST_SETTLE_TICK );
+    TEST_CHECK( eBUTTON_ON == test_state( eBUTTON_TEST_3 ));
+
+    // Pending change
+    cfg = test_get_cfg( eBUTTON_TEST_0 );
+    cfg.source = eBUTTON_SRC_VIRTUAL;
+    TEST_CHECK( eBUTTON_OK == button_set_cfg( eBUTTON_TEST_0, &cfg ));
+
+    TEST_CHECK( eBUTTON_OK == button_deinit());
+    test_init();
+
+    for ( button_num_t num = 0; num < eBUTTON_NUM_OF; num++ )
+    {
+        cfg = test_get_cfg( num );
+
+        TEST_CHECK( p_table[num].source == cfg.source );
+        TEST_CHECK( p_table[num].stream_bit == cfg.stream_bit );
+        TEST_CHECK( p_table[num].deb_press == cfg.deb_press );
+        TEST_CHECK( p_table[num].sample_div == cfg.sample_div );
+    }
+
+    // Virtual input cleared, new change accepted
+    TEST_CHECK( eBUTTON_OFF == test_state( eBUTTON_TEST_3 ));
+    TEST_CHECK( eBUTTON_OK == button_set_cfg( eBUTTON_TEST_0, &p_table[eBUTTON_TEST_0] ));
+    test_run( 1U );
+
+    TEST_CHECK( eBUTTON_OK == button_deinit());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Runtime configuration test entry
+*
+* @return       0 if all checks passed
+*/
+////////////////////////////////////////////////////////////////////////////////
+int main(void)
+{
+    test_boundary();
+    test_override();
+    test_source();
+    test_pending();
+    test_swap();
+    test_reinit();
+
+    printf( "Runtime configuration test: %s\n", ( true == gb_is_ok ) ? "passed" : "FAILED" );
+
+    return ( true == gb_is_ok ) ? 0 : 1;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,465 @@
+// Copyright (c) 2023 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @file     button_cfg.h
+* @brief    Base button configurations of host tests
+* @author   Ziga Miklosic
+* @email    ziga.miklosic@gmail.com
+* @date     18.10.2026
+* @version  V1.3.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @addtogroup BUTTON_CFG
+* @{ <!-- BEGIN GROUP -->
+*
+*
+*     Configuration for Button
+*
+*     User shall put code inside inside code block start with
+*     "USER_CODE_BEGIN" and with end of "USER_CODE_END".
+*
+*     Shared by all host tests. Each test provides "button_test_cfg.h"
+*     with list of buttons (button_num_t) and overrides of configuration
+*     options it needs. Options left out keep values below.
+*
+*/
+////////////////////////////////////////////////////////////////////////////////
+#ifndef __BUTTON_CFG_H_
+#define __BUTTON_CFG_H_
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+
+// Low level drivers
+#include "drivers/peripheral/gpio/gpio/src/gpio.h"
+
+// USER CODE BEGIN...
+
+#include <stdio.h>
+#include <assert.h>
+
+// Test specific buttons & configuration overrides
+#include "button_test_cfg.h"
+
+// USER CODE END...
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+// USER CODE BEGIN...
+
+/**
+ *     Main button handler period
+ *     Unit: sec
+ */
+#ifndef BUTTON_CFG_HNDL_PERIOD_S
+    #define BUTTON_CFG_HNDL_PERIOD_S        ( 0.01f )
+#endif
+
+/**
+ *     Enable/Disable usage of Filter module. It is being used for debouncing.
+ */
+#ifndef BUTTON_CFG_FILTER_EN
+    #define BUTTON_CFG_FILTER_EN            ( 1 )
+#endif
+
+/**
+ *     Maximum number of different sampling dividers
+ *
+ * @note    Buttons with the same sampling divider share single bucket.
+ */
+#ifndef BUTTON_CFG_SAMPLE_DIV_NUM
+    #define BUTTON_CFG_SAMPLE_DIV_NUM       ( 4U )
+#endif
+
+/**
+ *     Enable/Disable runtime configuration change
+ *
+ * @note    Configuration table is copied to RAM (two copies), so that it
+ *          can be changed at runtime without re-initialization.
+ */
+#ifndef BUTTON_CFG_RUNTIME_CFG_EN
+    #define BUTTON_CFG_RUNTIME_CFG_EN       ( 0 )
+#endif
+
+/**
+ *     Enable/Disable button statistics (press counter & cumulative active time)
+ *
+ * @note    Statistics are stored to non-volatile memory via
+ *          "button_cfg_stats_load" & "button_cfg_stats_store" functions.
+ */
+#ifndef BUTTON_CFG_STATS_EN
+    #define BUTTON_CFG_STATS_EN             ( 0 )
+#endif
+
+/**
+ *     Store statistics after that many unstored press events
+ */
+#ifndef BUTTON_CFG_STATS_FLUSH_EVENTS
+    #define BUTTON_CFG_STATS_FLUSH_EVENTS   ( 100U )
+#endif
+
+/**
+ *     Store statistics after that time, if there are unstored press events
+ *     or active time
+ *
+ *     Unit: sec
+ */
+#ifndef BUTTON_CFG_STATS_FLUSH_PERIOD_S
+    #define BUTTON_CFG_STATS_FLUSH_PERIOD_S ( 3600.0f )
+#endif
+
+/**
+ *     Enable/Disable binary event telemetry
+ *
+ * @note    Events are encoded into compact binary frames inside user
+ *          buffer. See "button_tlm.h" for details.
+ */
+#ifndef BUTTON_CFG_TLM_EN
+    #define BUTTON_CFG_TLM_EN               ( 0 )
+#endif
+
+/**
+ *     Enable/Disable oversampled (majority vote) input sampling
+ *
+ * @note    Inputs with "oversample" set are read BUTTON_CFG_OVERSAMPLE_NUM
+ *          times per sampling and majority of reads is passed to debouncer.
+ */
+#ifndef BUTTON_CFG_OVERSAMPLE_EN
+    #define BUTTON_CFG_OVERSAMPLE_EN        ( 0 )
+#endif
+
+/**
+ *     Number of input reads per sampling
+ *
+ * @note    Valid range: 2-15. Use odd number in order to avoid ties, as
+ *          tie is resolved as inactive input.
+ */
+#ifndef BUTTON_CFG_OVERSAMPLE_NUM
+    #define BUTTON_CFG_OVERSAMPLE_NUM       ( 5U )
+#endif
+
+/**
+ *     Enable/Disable streaming ingest of raw port samples
+ *
+ * @note    Inputs with stream source are debounced from raw port words
+ *          passed to "button_stream_ingest()" (e.g. GPIO input register
+ *          copied by timer triggered DMA) instead of being read by handler.
+ */
+#ifndef BUTTON_CFG_STREAM_EN
+    #define BUTTON_CFG_STREAM_EN            ( 0 )
+#endif
+
+/**
+ *     Stream debounce time
+ *
+ *     Unit: stream samples
+ *
+ * @note    Valid range: 1-65535. Input state changes after that many
+ *          consecutive samples of new state, thus debounce time is this
+ *          value divided by stream sample rate (e.g. 50 samples at 10 kHz
+ *          is 5 ms). Same for all stream inputs, "deb_" fields of
+ *          configuration table are not used for them.
+ *
+ *          Ingest cost per sample grows with number of bits of this value.
+ */
+#ifndef BUTTON_CFG_STREAM_DEB_NUM
+    #define BUTTON_CFG_STREAM_DEB_NUM       ( 8U )
+#endif
+
+/**
+ *     Enable/Disable derived (logical) inputs
+ *
+ * @note    Derived input state is AND/OR expression over other buttons,
+ *          set by "expr" field of configuration table.
+ */
+#ifndef BUTTON_CFG_DERIVED_EN
+    #define BUTTON_CFG_DERIVED_EN           ( 0 )
+#endif
+
+/**
+ *     Maximum number of derived inputs
+ */
+#ifndef BUTTON_CFG_DERIVED_NUM
+    #define BUTTON_CFG_DERIVED_NUM          ( 4U )
+#endif
+
+/**
+ *     Maximum number of terms of single derived input expression
+ *
+ * @note    Valid range: 1-8.
+ */
+#ifndef BUTTON_CFG_DERIVED_TERM_MAX
+    #define BUTTON_CFG_DERIVED_TERM_MAX     ( 4U )
+#endif
+
+/**
+ *     Enable/Disable auto-repeat (typematic) of held buttons
+ *
+ * @note    Repeats are reported via pressed callback, configured by "rep_"
+ *          fields of configuration table.
+ */
+#ifndef BUTTON_CFG_REPEAT_EN
+    #define BUTTON_CFG_REPEAT_EN            ( 0 )
+#endif
+
+/**
+ *     Maximum number of simultaneously repeating buttons
+ */
+#ifndef BUTTON_CFG_REPEAT_NUM
+    #define BUTTON_CFG_REPEAT_NUM           ( 4U )
+#endif
+
+/**
+ *     Enable/Disable press sequence recognizer
+ *
+ * @note    Sequences are registered via "button_seq_register()" and compiled
+ *          into automaton table of BUTTON_CFG_SEQ_STATE_NUM x eBUTTON_NUM_OF
+ *          bytes.
+ */
+#ifndef BUTTON_CFG_SEQ_EN
+    #define BUTTON_CFG_SEQ_EN               ( 0 )
+#endif
+
+/**
+ *     Maximum number of press sequences
+ */
+#ifndef BUTTON_CFG_SEQ_NUM
+    #define BUTTON_CFG_SEQ_NUM              ( 4U )
+#endif
+
+/**
+ *     Maximum length of single press sequence
+ */
+#ifndef BUTTON_CFG_SEQ_LEN_MAX
+    #define BUTTON_CFG_SEQ_LEN_MAX          ( 8U )
+#endif
+
+/**
+ *     Maximum number of sequence automaton states
+ *
+ * @note    Valid range: 2-256. Sum of lengths of all sequences plus one is
+ *          always enough.
+ */
+#ifndef BUTTON_CFG_SEQ_STATE_NUM
+    #define BUTTON_CFG_SEQ_STATE_NUM        ( 16U )
+#endif
+
+/**
+ *     Enable/Disable compact storage profile
+ *
+ * @note    Intended for large number of inputs. Button data uses 16-bit tick
+ *          counters, 2-bit state and index into shared callback table,
+ *          thus active & idle time are limited to 32767 handler periods.
+ *          Statistics (BUTTON_CFG_STATS_EN) are not limited.
+ */
+#ifndef BUTTON_CFG_COMPACT_EN
+    #define BUTTON_CFG_COMPACT_EN           ( 0 )
+#endif
+
+/**
+ *     Number of shared callback groups (compact profile)
+ *
+ * @note    Buttons registered with the same pair of callbacks share
+ *          single group. One group is reserved for no callbacks.
+ */
+#ifndef BUTTON_CFG_CB_GROUP_NUM
+    #define BUTTON_CFG_CB_GROUP_NUM         ( 8U )
+#endif
+
+/**
+ *     RAM budget of module data (compact profile)
+ *
+ *     Unit: bytes
+ *
+ * @note    Button data, callback groups, schedule, bitmasks and tables of
+ *          enabled features are checked at compile time.
+ */
+#ifndef BUTTON_CFG_RAM_BUDGET
+    #define BUTTON_CFG_RAM_BUDGET           ( 4096U )
+#endif
+
+/**
+ *     Enable/Disable debug mode
+ *
+ *     @note Disabled in release!
+ */
+#define BUTTON_CFG_DEBUG_EN                 ( 1 )
+#ifndef DEBUG
+    #undef BUTTON_CFG_DEBUG_EN
+    #define BUTTON_CFG_DEBUG_EN    ( 0 )
+#endif
+
+/**
+ *     Enable/Disable assertions
+ *
+ *     @note Disabled in release!
+ */
+#define BUTTON_CFG_ASSERT_EN                ( 1 )
+#ifndef DEBUG
+    #undef BUTTON_CFG_ASSERT_EN
+    #define BUTTON_CFG_ASSERT_EN    ( 0 )
+#endif
+
+/**
+ *     Enable/Disable handler self-check
+ *
+ *     Each handler call buttons skipped by fast path are checked
+ *     against per-button reference. Mismatch is reported via
+ *     BUTTON_PRINT & BUTTON_ASSERT.
+ *
+ *     @note Disabled in release!
+ */
+#define BUTTON_CFG_SELF_CHECK_EN            ( 1 )
+#ifndef DEBUG
+    #undef BUTTON_CFG_SELF_CHECK_EN
+    #define BUTTON_CFG_SELF_CHECK_EN    ( 0 )
+#endif
+
+/**
+ *     Debug communication port macros
+ */
+#if ( 1 == BUTTON_CFG_DEBUG_EN )
+    #define BUTTON_PRINT( ... )             { printf( __VA_ARGS__ ); printf( "\n" ); }
+#else
+    #define BUTTON_PRINT( ... )             { ; }
+
+#endif
+
+/**
+ *      Assertion macros
+ */
+#if ( 1 == BUTTON_CFG_ASSERT_EN )
+    #define BUTTON_ASSERT(x)                assert(x)
+#else
+    #define BUTTON_ASSERT(x)                { ; }
+#endif
+
+/**
+ *      Critical section macros
+ *
+ *      @note Protects virtual input writes. Must be defined if virtual inputs
+ *            are written from interrupt and another context!
+ */
+#ifndef BUTTON_CFG_ENTER_CRITICAL
+    #define BUTTON_CFG_ENTER_CRITICAL()     { ; }
+    #define BUTTON_CFG_EXIT_CRITICAL()      { ; }
+#endif
+
+// USER CODE END...
+
+/**
+ *  32-bit floating data type definition
+ */
+typedef float float32_t;
+
+/**
+ *     Button polarity
+ */
+typedef enum
+{
+    eBUTTON_POL_ACTIVE_HIGH = 0,    /**<Active high polarity */
+    eBUTTON_POL_ACTIVE_LOW,         /**<Active low polatiry */
+} button_polarity_t;
+
+/**
+ *     Button input source
+ */
+typedef enum
+{
+    eBUTTON_SRC_GPIO = 0,   /**<GPIO pin */
+    eBUTTON_SRC_VIRTUAL,    /**<Virtual input, written by application via "button_virt_set/write()" */
+    eBUTTON_SRC_STREAM,     /**<Bit of raw port word, passed via "button_stream_ingest()" */
+    eBUTTON_SRC_DERIVED,    /**<Logical expression over other buttons, set by "expr" */
+} button_src_t;
+
+/**
+ *     Button debounce mode
+ */
+typedef enum
+{
+    eBUTTON_DEB_LPF = 0,    /**<RC 1st order boolean filter, set by "lpf_en" & "lpf_fc" */
+    eBUTTON_DEB_DELAY,      /**<Report change after input is stable for press/release time */
+    eBUTTON_DEB_EAGER,      /**<Report change on first edge, then lock out for press/release time */
+} button_deb_mode_t;
+
+#if ( 1 == BUTTON_CFG_DERIVED_EN )
+
+    /**
+     *     Derived input expression operator
+     */
+    typedef enum
+    {
+        eBUTTON_EXPR_AND = 0,   /**<All terms active */
+        eBUTTON_EXPR_OR,        /**<Any term active */
+    } button_expr_op_t;
+
+    /**
+     *     Derived input expression
+     *
+     * @note    E.g. "CLOSE_SW && !OPEN_SW":
+     *
+     *          { .op = eBUTTON_EXPR_AND, .num_of = 2, .inv = 0x02,
+     *            .term = { eBUTTON_DELIVERY_CLOSE_SW, eBUTTON_DELIVERY_OPEN_SW }}
+     */
+    typedef struct
+    {
+        button_expr_op_t    op;                                 /**<Operator between terms */
+        uint8_t             num_of;                             /**<Number of terms */
+        uint8_t             inv;                                /**<Inverted terms, bit "i" inverts term "i" */
+        button_num_t        term[BUTTON_CFG_DERIVED_TERM_MAX];  /**<Term buttons. Shall not be derived inputs */
+    } button_expr_t;
+
+#endif
+
+/**
+ *     Button configuration
+ */
+typedef struct
+{
+    gpio_pin_t          gpio_pin;   /**<GPIO pin */
+    button_polarity_t   polarity;   /**<Polarity */
+    bool                lpf_en;     /**<Enable LPF */
+    float32_t           lpf_fc;     /**<Low pass filter cutoff freq */
+    button_deb_mode_t   deb_mode;   /**<Debounce mode */
+    float32_t           deb_press;  /**<Press debounce/lock-out time (DELAY & EAGER mode). Unit: sec */
+    float32_t           deb_release;/**<Release debounce/lock-out time (DELAY & EAGER mode). Unit: sec */
+    uint16_t            sample_div; /**<Sampling divider of handler period. 0 or 1 means each handler call */
+    button_src_t        source;     /**<Input source. GPIO if not set */
+    bool                oversample; /**<Majority vote of BUTTON_CFG_OVERSAMPLE_NUM reads (GPIO source only) */
+    uint8_t             stream_bit; /**<Bit of raw port word (STREAM source only) */
+    #if ( 1 == BUTTON_CFG_DERIVED_EN )
+        button_expr_t   expr;       /**<Expression (DERIVED source only) */
+    #endif
+    #if ( 1 == BUTTON_CFG_REPEAT_EN )
+        float32_t       rep_delay;  /**<Auto-repeat initial delay. 0 disables auto-repeat. Unit: sec */
+        float32_t       rep_period; /**<Auto-repeat initial period. Unit: sec */
+        float32_t       rep_accel;  /**<Auto-repeat period multiplier at each repeat (e.g. 0.8). 0 or 1 means no acceleration */
+        float32_t       rep_min;    /**<Auto-repeat minimum period. Unit: sec */
+    #endif
+} button_cfg_t;
+
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+const button_cfg_t * button_cfg_get_table(void);
+
+#if ( 1 == BUTTON_CFG_STATS_EN )
+    bool button_cfg_stats_load  (void * const p_data, const uint32_t size);
+    bool button_cfg_stats_store (const void * const p_data, const uint32_t size);
+#endif
+
+#endif // __BUTTON_CFG_H_
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
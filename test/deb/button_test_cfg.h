@@ -0,0 +1,49 @@
+// Copyright (c) 2023 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @file     button_test_cfg.h
+* @brief    Button list & configuration overrides for debounce test
+* @author   Ziga Miklosic
+* @email    ziga.miklosic@gmail.com
+* @date     18.10.2026
+* @version  V1.3.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @addtogroup BUTTON_CFG
+* @{ <!-- BEGIN GROUP -->
+*
+*     Included by base test configuration (test/common/button_cfg.h).
+*
+*/
+////////////////////////////////////////////////////////////////////////////////
+#ifndef __BUTTON_TEST_CFG_H_
+#define __BUTTON_TEST_CFG_H_
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *     List of Buttons
+ */
+typedef enum
+{
+    eBUTTON_TEST_0 = 0,         /**<Delay, asymmetric press & release time */
+    eBUTTON_TEST_1,             /**<Delay, zero press time */
+    eBUTTON_TEST_2,             /**<Eager */
+    eBUTTON_TEST_3,             /**<Delay, sampled at each third call, time rounded up */
+    eBUTTON_TEST_4,             /**<Delay, sampled at each third call, time multiple of sampling period */
+
+    eBUTTON_NUM_OF
+} button_num_t;
+
+#endif // __BUTTON_TEST_CFG_H_
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,372 @@
+// Copyright (c) 2023 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @file     test_deb.c
+* @brief    Delay & eager debounce test
+* @author   Ziga Miklosic
+* @email    ziga.miklosic@gmail.com
+* @date     18.10.2026
+* @version  V1.3.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @addtogroup BUTTON_TEST
+* @{ <!-- BEGIN GROUP -->
+*
+*   Number of handler calls from input edge to state change is measured.
+*   Delay debounce shall apply press and release time separately and
+*   switch on first sample when time is zero. Eager debounce shall switch
+*   on first sample and ignore bounces during lock-out. Debounce time
+*   shall be rounded up to whole sampling periods.
+*
+*   Usage: test_deb
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "button/src/button.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *     Number of handler calls in one second
+ */
+#define TEST_TICK_PER_S                     ((uint32_t)( 1.0f / BUTTON_CFG_HNDL_PERIOD_S + 0.5f ))
+
+/**
+ *     Maximum number of handler calls to wait for state change
+ */
+#define TEST_DETECT_MAX                     ( 100U )
+
+/**
+ *     Check condition and report failure
+ */
+#define TEST_CHECK( cond )                                                          \
+    do                                                                              \
+    {                                                                               \
+        if ( !( cond ))                                                             \
+        {                                                                           \
+            printf( "%s:%d: check failed: %s\n", __func__, __LINE__, #cond );       \
+            gb_is_ok = false;                                                       \
+        }                                                                           \
+    } while ( 0 )
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *     Test result
+ */
+static bool gb_is_ok = true;
+
+/**
+ *     Number of eager button callbacks
+ */
+static uint32_t g_press_cnt     = 0U;
+static uint32_t g_release_cnt   = 0U;
+
+////////////////////////////////////////////////////////////////////////////////
+// Function Prototypes
+////////////////////////////////////////////////////////////////////////////////
+static void             test_pressed    (void);
+static void             test_released   (void);
+static void             test_run        (const uint32_t tick);
+static button_state_t   test_state      (const button_num_t num);
+static void             test_set        (const button_num_t num, const gpio_state_t level);
+static uint32_t         test_detect     (const button_num_t num, const gpio_state_t level);
+static void             test_bounce     (const button_num_t num, const uint32_t tick);
+static void             test_delay      (void);
+static void             test_zero       (void);
+static void             test_eager      (void);
+static void             test_round      (void);
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Eager button pressed
+*
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_pressed(void)
+{
+    g_press_cnt++;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Eager button released
+*
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_released(void)
+{
+    g_release_cnt++;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Call button handler
+*
+* @param[in]    tick    - Number of handler calls
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_run(const uint32_t tick)
+{
+    for ( uint32_t i = 0U; i < tick; i++ )
+    {
+        (void) button_hndl();
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get button state
+*
+* @param[in]    num     - Button
+* @return       state   - State of button
+*/
+////////////////////////////////////////////////////////////////////////////////
+static button_state_t test_state(const button_num_t num)
+{
+    button_state_t state = eBUTTON_UNKNOWN;
+
+    TEST_CHECK( eBUTTON_OK == button_get_state( num, &state ));
+
+    return state;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Set button input
+*
+* @param[in]    num     - Button
+* @param[in]    level   - Input level
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_set(const button_num_t num, const gpio_state_t level)
+{
+    gpio_stub_set( button_cfg_get_table()[num].gpio_pin, level );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Set button input and wait for state to follow
+*
+* @note     All test buttons are active high.
+*
+* @param[in]    num     - Button
+* @param[in]    level   - Input level
+* @return       tick    - Number of handler calls till state change,
+*                         TEST_DETECT_MAX + 1 if state did not change
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t test_detect(const button_num_t num, const gpio_state_t level)
+{
+    const button_state_t    state   = ( eGPIO_HIGH == level ) ? eBUTTON_ON : eBUTTON_OFF;
+    uint32_t                tick    = 0U;
+
+    test_set( num, level );
+
+    for ( tick = 1U; tick <= TEST_DETECT_MAX; tick++ )
+    {
+        (void) button_hndl();
+
+        if ( state == test_state( num ))
+        {
+            break;
+        }
+    }
+
+    return tick;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Toggle button input at each handler call
+*
+* @note     Input is left at level opposite to starting one for even
+*           number of calls.
+*
+* @param[in]    num     - Button
+* @param[in]    tick    - Number of handler calls
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_bounce(const button_num_t num, const uint32_t tick)
+{
+    gpio_state_t level = ( eBUTTON_ON == test_state( num )) ? eGPIO_LOW : eGPIO_HIGH;
+
+    for ( uint32_t i = 0U; i < tick; i++ )
+    {
+        test_set( num, level );
+        test_run( 1U );
+
+        level = ( eGPIO_HIGH == level ) ? eGPIO_LOW : eGPIO_HIGH;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Delay debounce applies press & release time separately
+*
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_delay(void)
+{
+    // Press shorter than press time (0.05 sec) is ignored
+    test_set( eBUTTON_TEST_0, eGPIO_HIGH );
+    test_run( 4U );
+    test_set( eBUTTON_TEST_0, eGPIO_LOW );
+    test_run( TEST_TICK_PER_S );
+    TEST_CHECK( eBUTTON_OFF == test_state( eBUTTON_TEST_0 ));
+
+    TEST_CHECK( 5U == test_detect( eBUTTON_TEST_0, eGPIO_HIGH ));
+
+    // Release shorter than release time (0.2 sec) is ignored
+    test_set( eBUTTON_TEST_0, eGPIO_LOW );
+    test_run( 19U );
+    test_set( eBUTTON_TEST_0, eGPIO_HIGH );
+    test_run( TEST_TICK_PER_S );
+    TEST_CHECK( eBUTTON_ON == test_state( eBUTTON_TEST_0 ));
+
+    TEST_CHECK( 20U == test_detect( eBUTTON_TEST_0, eGPIO_LOW ));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Delay debounce with zero press time switches on first sample
+*
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_zero(void)
+{
+    TEST_CHECK( 1U == test_detect( eBUTTON_TEST_1, eGPIO_HIGH ));
+    TEST_CHECK( 3U == test_detect( eBUTTON_TEST_1, eGPIO_LOW ));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Eager debounce ignores bounces during lock-out
+*
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_eager(void)
+{
+    TEST_CHECK( eBUTTON_OK == button_register_callback( eBUTTON_TEST_2, test_pressed, test_released ));
+
+    TEST_CHECK( 1U == test_detect( eBUTTON_TEST_2, eGPIO_HIGH ));
+
+    // Press lock-out of 0.1 sec
+    test_bounce( eBUTTON_TEST_2, 10U );
+    TEST_CHECK( eBUTTON_ON == test_state( eBUTTON_TEST_2 ));
+    TEST_CHECK( 1U == g_press_cnt );
+    TEST_CHECK( 0U == g_release_cnt );
+
+    TEST_CHECK( 1U == test_detect( eBUTTON_TEST_2, eGPIO_LOW ));
+
+    // Release lock-out of 0.05 sec
+    test_bounce( eBUTTON_TEST_2, 5U );
+    TEST_CHECK( eBUTTON_OFF == test_state( eBUTTON_TEST_2 ));
+    TEST_CHECK( 1U == g_press_cnt );
+    TEST_CHECK( 1U == g_release_cnt );
+
+    TEST_CHECK( 1U == test_detect( eBUTTON_TEST_2, eGPIO_HIGH ));
+    TEST_CHECK( 2U == g_press_cnt );
+
+    // Lock-out expired while input was steady
+    test_run( TEST_TICK_PER_S );
+    TEST_CHECK( 1U == test_detect( eBUTTON_TEST_2, eGPIO_LOW ));
+    TEST_CHECK( 2U == g_release_cnt );
+
+    TEST_CHECK( eBUTTON_OK == button_unregister_callback( eBUTTON_TEST_2 ));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Debounce time is rounded up to whole sampling periods
+*
+* @note     Buttons are sampled at each third handler call (0.03 sec), thus
+*           state follows within ( N-1 ) * 3 + 1 and N * 3 handler calls
+*           for N samples.
+*
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_round(void)
+{
+    uint32_t tick = 0U;
+
+    // 0.05 sec: 2 samples
+    tick = test_detect( eBUTTON_TEST_3, eGPIO_HIGH );
+    TEST_CHECK(( tick >= 4U ) && ( tick <= 6U ));
+    tick = test_detect( eBUTTON_TEST_3, eGPIO_LOW );
+    TEST_CHECK(( tick >= 4U ) && ( tick <= 6U ));
+
+    // 0.06 sec: exactly 2 samples
+    tick = test_detect( eBUTTON_TEST_4, eGPIO_HIGH );
+    TEST_CHECK(( tick >= 4U ) && ( tick <= 6U ));
+    tick = test_detect( eBUTTON_TEST_4, eGPIO_LOW );
+    TEST_CHECK(( tick >= 4U ) && ( tick <= 6U ));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Debounce test entry
+*
+* @return       0 if all checks passed
+*/
+////////////////////////////////////////////////////////////////////////////////
+int main(void)
+{
+    for ( button_num_t num = 0; num < eBUTTON_NUM_OF; num++ )
+    {
+        test_set( num, eGPIO_LOW );
+    }
+
+    TEST_CHECK( eBUTTON_OK == button_init());
+
+    test_run( TEST_TICK_PER_S );
+
+    for ( button_num_t num = 0; num < eBUTTON_NUM_OF; num++ )
+    {
+        TEST_CHECK( eBUTTON_OFF == test_state( num ));
+    }
+
+    test_delay();
+    test_zero();
+    test_eager();
+    test_round();
+
+    TEST_CHECK( eBUTTON_OK == button_deinit());
+
+    printf( "Debounce test: %s\n", ( true == gb_is_ok ) ? "passed" : "FAILED" );
+
+    return ( true == gb_is_ok ) ? 0 : 1;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,57 @@
+// Copyright (c) 2023 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @file     button_test_cfg.h
+* @brief    Button list & configuration overrides for derived input test
+* @author   Ziga Miklosic
+* @email    ziga.miklosic@gmail.com
+* @date     18.10.2026
+* @version  V1.3.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @addtogroup BUTTON_CFG
+* @{ <!-- BEGIN GROUP -->
+*
+*     Included by base test configuration (test/common/button_cfg.h).
+*
+*/
+////////////////////////////////////////////////////////////////////////////////
+#ifndef __BUTTON_TEST_CFG_H_
+#define __BUTTON_TEST_CFG_H_
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *     List of Buttons
+ */
+typedef enum
+{
+    eBUTTON_TEST_A = 0,         /**<Term */
+    eBUTTON_TEST_B,             /**<Term */
+    eBUTTON_TEST_C,             /**<Term */
+    eBUTTON_TEST_D,             /**<Not a term of any expression */
+    eBUTTON_TEST_AND,           /**<A && B */
+    eBUTTON_TEST_OR,            /**<A || C */
+    eBUTTON_TEST_INV,           /**<A && !B */
+    eBUTTON_TEST_NAND,          /**<!A || !C */
+
+    eBUTTON_NUM_OF
+} button_num_t;
+
+/**
+ *     Configuration overrides
+ */
+#define BUTTON_CFG_DERIVED_EN               ( 1 )
+
+#endif // __BUTTON_TEST_CFG_H_
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
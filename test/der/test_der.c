@@ -0,0 +1,338 @@
+// Copyright (c) 2023 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @file     test_der.c
+* @brief    Derived input test
+* @author   Ziga Miklosic
+* @email    ziga.miklosic@gmail.com
+* @date     18.10.2026
+* @version  V1.3.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @addtogroup BUTTON_TEST
+* @{ <!-- BEGIN GROUP -->
+*
+*   Derived inputs A && B, A || C, A && !B and !A || !C over terms with
+*   zero debounce time. Derived input shall be unknown until all its terms
+*   are known, follow its expression in the same handler call as term for
+*   all term states and report change only when its own terms change it.
+*
+*   Usage: test_der
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "button/src/button.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *     Check condition and report failure
+ */
+#define TEST_CHECK( cond )                                                          \
+    do                                                                              \
+    {                                                                               \
+        if ( !( cond ))                                                             \
+        {                                                                           \
+            printf( "%s:%d: check failed: %s\n", __func__, __LINE__, #cond );       \
+            gb_is_ok = false;                                                       \
+        }                                                                           \
+    } while ( 0 )
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *     Test result
+ */
+static bool gb_is_ok = true;
+
+/**
+ *     Number of derived input changes reported by callbacks
+ */
+static uint32_t g_and_cnt   = 0U;
+static uint32_t g_nand_cnt  = 0U;
+
+////////////////////////////////////////////////////////////////////////////////
+// Function Prototypes
+////////////////////////////////////////////////////////////////////////////////
+static void             test_and_change     (void);
+static void             test_nand_change    (void);
+static void             test_run            (const uint32_t tick);
+static button_state_t   test_state          (const button_num_t num);
+static void             test_set            (const button_num_t num, const bool active);
+static void             test_expect         (const bool a, const bool b, const bool c);
+static void             test_unknown        (void);
+static void             test_truth          (void);
+static void             test_other          (void);
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       A && B changed
+*
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_and_change(void)
+{
+    g_and_cnt++;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       !A || !C changed
+*
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_nand_change(void)
+{
+    g_nand_cnt++;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Call button handler
+*
+* @param[in]    tick    - Number of handler calls
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_run(const uint32_t tick)
+{
+    for ( uint32_t i = 0U; i < tick; i++ )
+    {
+        (void) button_hndl();
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get button state
+*
+* @param[in]    num     - Button
+* @return       state   - State of button
+*/
+////////////////////////////////////////////////////////////////////////////////
+static button_state_t test_state(const button_num_t num)
+{
+    button_state_t state = eBUTTON_UNKNOWN;
+
+    TEST_CHECK( eBUTTON_OK == button_get_state( num, &state ));
+
+    return state;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Set term input
+*
+* @param[in]    num     - Button
+* @param[in]    active  - Input active
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_set(const button_num_t num, const bool active)
+{
+    gpio_stub_set( button_cfg_get_table()[num].gpio_pin, ( true == active ) ? eGPIO_HIGH : eGPIO_LOW );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Check states of derived inputs
+*
+* @param[in]    a       - Term A active
+* @param[in]    b       - Term B active
+* @param[in]    c       - Term C active
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_expect(const bool a, const bool b, const bool c)
+{
+    const bool and  = ( a && b );
+    const bool or   = ( a || c );
+    const bool inv  = ( a && !b );
+    const bool nand = ( !a || !c );
+
+    if  (   ((( true == and ) ? eBUTTON_ON : eBUTTON_OFF ) != test_state( eBUTTON_TEST_AND ))
+        ||  ((( true == or ) ? eBUTTON_ON : eBUTTON_OFF ) != test_state( eBUTTON_TEST_OR ))
+        ||  ((( true == inv ) ? eBUTTON_ON : eBUTTON_OFF ) != test_state( eBUTTON_TEST_INV ))
+        ||  ((( true == nand ) ? eBUTTON_ON : eBUTTON_OFF ) != test_state( eBUTTON_TEST_NAND )))
+    {
+        printf( "terms A=%d B=%d C=%d: wrong derived state\n", a, b, c );
+        gb_is_ok = false;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Derived input is unknown until all its terms are known
+*
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_unknown(void)
+{
+    for ( button_num_t num = eBUTTON_TEST_AND; num < eBUTTON_NUM_OF; num++ )
+    {
+        TEST_CHECK( eBUTTON_UNKNOWN == test_state( num ));
+    }
+
+    // Term A shared by all expressions
+    gpio_stub_set( button_cfg_get_table()[eBUTTON_TEST_A].gpio_pin, eGPIO_UKNOWN );
+    test_run( 1U );
+
+    TEST_CHECK( eBUTTON_OFF == test_state( eBUTTON_TEST_B ));
+    TEST_CHECK( eBUTTON_OFF == test_state( eBUTTON_TEST_C ));
+
+    for ( button_num_t num = eBUTTON_TEST_AND; num < eBUTTON_NUM_OF; num++ )
+    {
+        TEST_CHECK( eBUTTON_UNKNOWN == test_state( num ));
+    }
+
+    test_set( eBUTTON_TEST_A, false );
+    test_run( 1U );
+    test_expect( false, false, false );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Derived inputs follow expression for all term states
+*
+* @note     Terms are stepped in Gray code, thus single term changes at
+*           each step.
+*
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_truth(void)
+{
+    bool and_prev   = false;
+    bool nand_prev  = true;
+
+    g_and_cnt   = 0U;
+    g_nand_cnt  = 0U;
+
+    for ( uint32_t step = 1U; step <= 16U; step++ )
+    {
+        const uint32_t  gray        = (( step ^ ( step >> 1U )) & 0x07U );
+        const bool      a           = ( 0U != ( gray & 0x01U ));
+        const bool      b           = ( 0U != ( gray & 0x02U ));
+        const bool      c           = ( 0U != ( gray & 0x04U ));
+        const uint32_t  and_cnt     = g_and_cnt;
+        const uint32_t  nand_cnt    = g_nand_cnt;
+
+        test_set( eBUTTON_TEST_A, a );
+        test_set( eBUTTON_TEST_B, b );
+        test_set( eBUTTON_TEST_C, c );
+
+        // Evaluated in the same handler call as terms
+        test_run( 1U );
+        test_expect( a, b, c );
+
+        // Reported only when expression changes
+        TEST_CHECK(( and_cnt + ((( a && b ) != and_prev ) ? 1U : 0U )) == g_and_cnt );
+        TEST_CHECK(( nand_cnt + ((( !a || !c ) != nand_prev ) ? 1U : 0U )) == g_nand_cnt );
+
+        and_prev    = ( a && b );
+        nand_prev   = ( !a || !c );
+    }
+
+    TEST_CHECK( g_and_cnt > 0U );
+    TEST_CHECK( g_nand_cnt > 0U );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Changes of non-term buttons do not change derived inputs
+*
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_other(void)
+{
+    const uint32_t and_cnt  = g_and_cnt;
+    const uint32_t nand_cnt = g_nand_cnt;
+
+    // A && B and !A || !C active
+    test_set( eBUTTON_TEST_A, true );
+    test_set( eBUTTON_TEST_B, true );
+    test_set( eBUTTON_TEST_C, false );
+    test_run( 1U );
+    test_expect( true, true, false );
+
+    TEST_CHECK(( and_cnt + 1U ) == g_and_cnt );
+
+    for ( uint32_t i = 0U; i < 10U; i++ )
+    {
+        test_set( eBUTTON_TEST_D, ( 0U == ( i & 1U )));
+        test_run( 1U );
+        test_expect( true, true, false );
+    }
+
+    TEST_CHECK(( and_cnt + 1U ) == g_and_cnt );
+    TEST_CHECK( nand_cnt == g_nand_cnt );
+
+    // Term changes not affecting !A || !C
+    test_set( eBUTTON_TEST_A, false );
+    test_run( 1U );
+    test_set( eBUTTON_TEST_C, true );
+    test_run( 1U );
+    test_set( eBUTTON_TEST_C, false );
+    test_run( 1U );
+    test_expect( false, true, false );
+
+    TEST_CHECK(( and_cnt + 2U ) == g_and_cnt );
+    TEST_CHECK( nand_cnt == g_nand_cnt );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Derived input test entry
+*
+* @return       0 if all checks passed
+*/
+////////////////////////////////////////////////////////////////////////////////
+int main(void)
+{
+    for ( button_num_t num = 0; num < eBUTTON_TEST_AND; num++ )
+    {
+        test_set( num, false );
+    }
+
+    TEST_CHECK( eBUTTON_OK == button_init());
+    TEST_CHECK( eBUTTON_OK == button_register_callback( eBUTTON_TEST_AND, test_and_change, test_and_change ));
+    TEST_CHECK( eBUTTON_OK == button_register_callback( eBUTTON_TEST_NAND, test_nand_change, test_nand_change ));
+
+    test_unknown();
+    test_truth();
+    test_other();
+
+    TEST_CHECK( eBUTTON_OK == button_deinit());
+
+    printf( "Derived input test: %s\n", ( true == gb_is_ok ) ? "passed" : "FAILED" );
+
+    return ( true == gb_is_ok ) ? 0 : 1;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
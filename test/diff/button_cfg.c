@@ -0,0 +1,178 @@
+// Copyright (c) 2023 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @file     button_cfg.c
+* @brief    Button configurations for differential test against V1.2.0 handler
+* @author   Ziga Miklosic
+* @email    ziga.miklosic@gmail.com
+* @date     18.10.2026
+* @version  V1.3.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+ * @addtogroup BUTTON_CFG
+ * @{ <!-- BEGIN GROUP -->
+ */
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include "button_cfg.h"
+#include "button/src/button.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *     Button configuration table
+ *
+ *  @brief  LPF is RC 1st order IIR filter. Output is being compared between
+ *          5% and 95% (3 Tao).
+ *
+ *          E.g. LPF with fc=1Hz will result in button detection time delay
+ *          of:
+ *
+ *                 fc = 1 / ( 2*pi*Tao ) ---> Tao = 1 / ( 2*pi*fc )
+ *
+ *                 dt = 3 Tao = 3 * 1 / ( 2*pi*fc )
+ *
+ *                 fc = 1.0 Hz ---> dt = 0.477 sec
+ *
+ *          DELAY debounce mode reports change after input is stable for
+ *          "deb_press" (OFF->ON) or "deb_release" (ON->OFF) time.
+ *
+ *          EAGER debounce mode reports change on first sample of the new
+ *          state and then ignores input for "deb_press" or "deb_release" time.
+ *          Detection delay is zero, thus it is suited for safety end-switches.
+ *
+ *          Sampling divider sets button sampling period to "sample_div" times
+ *          BUTTON_CFG_HNDL_PERIOD_S. Slow inputs (e.g. front panel keys) can be
+ *          sampled less often than safety inputs, reducing handler load.
+ *          Number of different dividers is limited by BUTTON_CFG_SAMPLE_DIV_NUM.
+ *
+ *          Input "source" defaults to GPIO. Buttons with virtual source are
+ *          written by application (e.g. from communication or other module)
+ *          and are debounced the same way as GPIO inputs.
+ *
+ *          With "oversample" set (and BUTTON_CFG_OVERSAMPLE_EN enabled) GPIO
+ *          input is read BUTTON_CFG_OVERSAMPLE_NUM times per sampling and
+ *          majority of reads is debounced. Suited for noisy lines, where
+ *          EMI spike can align with single read (e.g. bridge fault lines).
+ *
+ *          Inputs with stream source (BUTTON_CFG_STREAM_EN enabled) take
+ *          "stream_bit" of raw port words passed to "button_stream_ingest()"
+ *          and are debounced for BUTTON_CFG_STREAM_DEB_NUM samples. Debounce
+ *          fields of configuration table are not used for them.
+ *
+ *          Derived inputs (BUTTON_CFG_DERIVED_EN enabled) are AND/OR
+ *          expressions over other buttons, set by "expr" field. They are
+ *          evaluated after debouncing, only when one of terms changed, and
+ *          have their own callbacks and timings.
+ *
+ *          Auto-repeat (BUTTON_CFG_REPEAT_EN enabled) repeats pressed
+ *          callback of held button after "rep_delay", every "rep_period".
+ *          Period is multiplied by "rep_accel" at each repeat, down to
+ *          "rep_min".
+ */
+static const button_cfg_t g_button_cfg[ eBUTTON_NUM_OF ] =
+{
+    // USER CODE BEGIN...
+
+    //                      Gpio pin enumeration            Button polarity                         LPF enable          Default LPF fc      Debounce mode                   Press debounce time     Release debounce time   Sampling divider
+    [eBUTTON_TEST_0]    = { .gpio_pin = eGPIO_PIN_0,    .polarity = eBUTTON_POL_ACTIVE_HIGH,    .lpf_en = true,     .lpf_fc = 10.0f,    .deb_mode = eBUTTON_DEB_LPF,    .deb_press = 0.0f,      .deb_release = 0.0f,    .sample_div = 1U    },
+    [eBUTTON_TEST_1]    = { .gpio_pin = eGPIO_PIN_1,    .polarity = eBUTTON_POL_ACTIVE_LOW,     .lpf_en = true,     .lpf_fc = 2.0f,     .deb_mode = eBUTTON_DEB_LPF,    .deb_press = 0.0f,      .deb_release = 0.0f,    .sample_div = 1U    },
+    [eBUTTON_TEST_2]    = { .gpio_pin = eGPIO_PIN_2,    .polarity = eBUTTON_POL_ACTIVE_HIGH,    .lpf_en = false,    .lpf_fc = 10.0f,    .deb_mode = eBUTTON_DEB_LPF,    .deb_press = 0.0f,      .deb_release = 0.0f,    .sample_div = 1U    },
+    [eBUTTON_TEST_3]    = { .gpio_pin = eGPIO_PIN_3,    .polarity = eBUTTON_POL_ACTIVE_LOW,     .lpf_en = false,    .lpf_fc = 10.0f,    .deb_mode = eBUTTON_DEB_LPF,    .deb_press = 0.0f,      .deb_release = 0.0f,    .sample_div = 1U    },
+    [eBUTTON_TEST_4]    = { .gpio_pin = eGPIO_PIN_4,    .polarity = eBUTTON_POL_ACTIVE_HIGH,    .lpf_en = true,     .lpf_fc = 30.0f,    .deb_mode = eBUTTON_DEB_LPF,    .deb_press = 0.0f,      .deb_release = 0.0f,    .sample_div = 1U    },
+    [eBUTTON_TEST_5]    = { .gpio_pin = eGPIO_PIN_5,    .polarity = eBUTTON_POL_ACTIVE_HIGH,    .lpf_en = true,     .lpf_fc = 5.0f,     .deb_mode = eBUTTON_DEB_LPF,    .deb_press = 0.0f,      .deb_release = 0.0f,    .sample_div = 1U    },
+    [eBUTTON_TEST_6]    = { .gpio_pin = eGPIO_PIN_6,    .polarity = eBUTTON_POL_ACTIVE_HIGH,    .lpf_en = false,    .lpf_fc = 10.0f,    .deb_mode = eBUTTON_DEB_LPF,    .deb_press = 0.0f,      .deb_release = 0.0f,    .sample_div = 1U    },
+    [eBUTTON_TEST_7]    = { .gpio_pin = eGPIO_PIN_7,    .polarity = eBUTTON_POL_ACTIVE_LOW,     .lpf_en = true,     .lpf_fc = 1.0f,     .deb_mode = eBUTTON_DEB_LPF,    .deb_press = 0.0f,      .deb_release = 0.0f,    .sample_div = 1U    },
+
+    // USER CODE END...
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*        Get button configuration table
+*
+* @return        pointer to configuration table
+*/
+////////////////////////////////////////////////////////////////////////////////
+const button_cfg_t * button_cfg_get_table(void)
+{
+    return (button_cfg_t*) &g_button_cfg;
+}
+
+#if ( 1 == BUTTON_CFG_STATS_EN )
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *        Load button statistics from non-volatile memory
+    *
+    * @note     Data validity is checked by Button module, thus raw content of
+    *           memory can be returned.
+    *
+    * @param[out]   p_data  - Pointer to statistics data
+    * @param[in]    size    - Size of statistics data in bytes
+    * @return       true if data is read
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    bool button_cfg_stats_load(void * const p_data, const uint32_t size)
+    {
+        bool is_ok = false;
+
+        // USER CODE BEGIN...
+
+        // Read "size" bytes from NVM into "p_data" here...
+        // E.g. on host simple file read can be used for testing purposes
+        (void) p_data;
+        (void) size;
+
+        // USER CODE END...
+
+        return is_ok;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /**
+    *        Store button statistics to non-volatile memory
+    *
+    * @note     Called by Button module only when enough events are collected
+    *           or after BUTTON_CFG_STATS_FLUSH_PERIOD_S, so it is wear friendly.
+    *
+    * @param[in]    p_data  - Pointer to statistics data
+    * @param[in]    size    - Size of statistics data in bytes
+    * @return       true if data is written
+    */
+    ////////////////////////////////////////////////////////////////////////////////
+    bool button_cfg_stats_store(const void * const p_data, const uint32_t size)
+    {
+        bool is_ok = false;
+
+        // USER CODE BEGIN...
+
+        // Write "size" bytes of "p_data" to NVM here...
+        // E.g. on host simple file write can be used for testing purposes
+        (void) p_data;
+        (void) size;
+
+        // USER CODE END...
+
+        return is_ok;
+    }
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+ * @} <!-- END GROUP -->
+ */
+////////////////////////////////////////////////////////////////////////////////
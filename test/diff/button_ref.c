@@ -0,0 +1,74 @@
+// Copyright (c) 2023 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @file     button_ref.c
+* @brief    Reference (V1.2.0) button handler with renamed API
+* @author   Ziga Miklosic
+* @email    ziga.miklosic@gmail.com
+* @date     18.10.2026
+* @version  V1.3.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @addtogroup BUTTON_TEST
+* @{ <!-- BEGIN GROUP -->
+*
+*   Reference processes each button at each handler call, accumulates
+*   timings and raises callbacks from current & previous state. Its API is
+*   prefixed with "ref_", so that it can be linked together with tested
+*   module and run on the same inputs.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include "button_ref.h"
+
+#define button_init                 ref_button_init
+#define button_deinit               ref_button_deinit
+#define button_is_init              ref_button_is_init
+#define button_hndl                 ref_button_hndl
+#define button_get_state            ref_button_get_state
+#define button_get_time             ref_button_get_time
+#define button_set_enable           ref_button_set_enable
+#define button_get_enable           ref_button_get_enable
+#define button_register_callback    ref_button_register_callback
+#define button_unregister_callback  ref_button_unregister_callback
+#define button_reset_filter         ref_button_reset_filter
+#define button_change_filter_fc     ref_button_change_filter_fc
+
+#include "../ref/button.c"
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Reset reference handler
+*
+* @note     Reference de-initialization is empty (V1.2.0 bug), thus filters
+*           are released and init flag is cleared here.
+*
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void ref_button_reset(void)
+{
+    #if ( 1 == BUTTON_CFG_FILTER_EN )
+        for ( button_num_t num = 0; num < eBUTTON_NUM_OF; num++ )
+        {
+            if ( NULL != g_button[num].filt )
+            {
+                (void) filter_bool_deinit( &( g_button[num].filt ));
+            }
+        }
+    #endif
+
+    gb_is_init = false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,56 @@
+// Copyright (c) 2023 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @file     button_ref.h
+* @brief    Reference (V1.2.0) button handler with renamed API
+* @author   Ziga Miklosic
+* @email    ziga.miklosic@gmail.com
+* @date     18.10.2026
+* @version  V1.3.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @addtogroup BUTTON_TEST
+* @{ <!-- BEGIN GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+#ifndef __BUTTON_REF_H_
+#define __BUTTON_REF_H_
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "button/src/button.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+button_status_t ref_button_init                 (void);
+button_status_t ref_button_deinit               (void);
+button_status_t ref_button_is_init              (bool * const p_is_init);
+button_status_t ref_button_hndl                 (void);
+button_status_t ref_button_get_state            (const button_num_t num, button_state_t * const p_state);
+button_status_t ref_button_get_time             (const button_num_t num, float32_t * const p_active_time, float32_t * const p_idle_time);
+button_status_t ref_button_set_enable           (const button_num_t num, const bool enable);
+button_status_t ref_button_get_enable           (const button_num_t num, bool * const p_enable);
+button_status_t ref_button_register_callback    (const button_num_t num, pf_button_callback pf_pressed, pf_button_callback pf_released);
+button_status_t ref_button_unregister_callback  (const button_num_t num);
+void            ref_button_reset                (void);
+
+#if ( 1 == BUTTON_CFG_FILTER_EN )
+    button_status_t ref_button_reset_filter     (const button_num_t num);
+    button_status_t ref_button_change_filter_fc (const button_num_t num, const float32_t fc);
+#endif
+
+#endif // __BUTTON_REF_H_
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,57 @@
+// Copyright (c) 2023 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @file     button_test_cfg.h
+* @brief    Button list & configuration overrides for differential test against V1.2.0 handler
+* @author   Ziga Miklosic
+* @email    ziga.miklosic@gmail.com
+* @date     18.10.2026
+* @version  V1.3.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @addtogroup BUTTON_CFG
+* @{ <!-- BEGIN GROUP -->
+*
+*     Included by base test configuration (test/common/button_cfg.h).
+*
+*/
+////////////////////////////////////////////////////////////////////////////////
+#ifndef __BUTTON_TEST_CFG_H_
+#define __BUTTON_TEST_CFG_H_
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *     List of Buttons
+ */
+typedef enum
+{
+    eBUTTON_TEST_0 = 0,         /**<LPF, active high */
+    eBUTTON_TEST_1,             /**<LPF, active low */
+    eBUTTON_TEST_2,             /**<No LPF, active high */
+    eBUTTON_TEST_3,             /**<No LPF, active low */
+    eBUTTON_TEST_4,             /**<Fast LPF, active high */
+    eBUTTON_TEST_5,             /**<LPF, active high */
+    eBUTTON_TEST_6,             /**<No LPF, active high */
+    eBUTTON_TEST_7,             /**<Slow LPF, active low */
+
+    eBUTTON_NUM_OF
+} button_num_t;
+
+/**
+ *     Configuration overrides
+ */
+#define BUTTON_CFG_CB_GROUP_NUM             ( eBUTTON_NUM_OF + 1U )
+
+#endif // __BUTTON_TEST_CFG_H_
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
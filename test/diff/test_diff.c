@@ -0,0 +1,455 @@
+// Copyright (c) 2023 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @file     test_diff.c
+* @brief    Randomized differential test against V1.2.0 button handler
+* @author   Ziga Miklosic
+* @email    ziga.miklosic@gmail.com
+* @date     18.10.2026
+* @version  V1.3.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @addtogroup BUTTON_TEST
+* @{ <!-- BEGIN GROUP -->
+*
+*   Tested module and reference (V1.2.0) handler run side by side on the
+*   same random GPIO waveforms (bouncing, slow, held and unknown inputs),
+*   random enable toggles, callback (un)registrations, filter resets and
+*   cutoff changes. After each handler call state, enable, timings and
+*   sequence of raised callbacks are compared.
+*
+*   Usage: test_diff [number of seeds] [number of ticks]
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <math.h>
+
+#include "button/src/button.h"
+#include "button_ref.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *     Default number of seeds and handler calls per seed
+ */
+#define TEST_SEED_NUM                       ( 40U )
+#define TEST_TICK_NUM                       ( 100000U )
+
+/**
+ *     Maximum number of callbacks within single handler call
+ */
+#define TEST_EVENT_MAX                      ( 2U * eBUTTON_NUM_OF )
+
+/**
+ *     Timing tolerance
+ *
+ * @note    Reference accumulates period in floating point each call, thus
+ *          its timings drift away from exact value. Half of period is
+ *          allowed on top of relative drift, so that single tick
+ *          difference is still detected.
+ */
+#define TEST_TIME_TOL( time )               (( 0.5f * BUTTON_CFG_HNDL_PERIOD_S ) + ( 1E-4f * ( time )))
+
+#if ( 1 == BUTTON_CFG_COMPACT_EN )
+
+    /**
+     *     Timing limit of compact profile
+     */
+    #define TEST_TIME_MAX                   ((float32_t)( 0x7FFFU - (uint32_t) eBUTTON_NUM_OF ) * BUTTON_CFG_HNDL_PERIOD_S )
+
+#endif
+
+/**
+ *     Implementation under test
+ */
+typedef enum
+{
+    eTEST_DUT = 0,      /**<Tested module */
+    eTEST_REF,          /**<Reference handler */
+
+    eTEST_IMPL_NUM_OF
+} test_impl_t;
+
+/**
+ *     Input waveform type
+ */
+typedef enum
+{
+    eTEST_WAVE_BOUNCE = 0,  /**<Input toggles very often */
+    eTEST_WAVE_SLOW,        /**<Input toggles every few ten calls */
+    eTEST_WAVE_HOLD,        /**<Input is held for long time */
+    eTEST_WAVE_UNKNOWN,     /**<Input level is sometimes unknown */
+
+    eTEST_WAVE_NUM_OF
+} test_wave_t;
+
+/**
+ *     Raised callback
+ */
+typedef struct
+{
+    button_num_t    num;        /**<Button */
+    bool            pressed;    /**<Pressed (true) or released (false) callback */
+} test_event_t;
+
+/**
+ *     Callback trampolines of single button
+ */
+#define TEST_CB_DEF( impl, num )                                                            \
+    static void test_pressed_##impl##_##num(void)   { test_event_log( impl, num, true ); }  \
+    static void test_released_##impl##_##num(void)  { test_event_log( impl, num, false ); }
+
+#define TEST_CB_PRESSED( num )              { test_pressed_0_##num, test_pressed_1_##num }
+#define TEST_CB_RELEASED( num )             { test_released_0_##num, test_released_1_##num }
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *     Raised callbacks at current handler call
+ */
+static test_event_t g_event[eTEST_IMPL_NUM_OF][TEST_EVENT_MAX] = { 0 };
+static uint32_t     g_event_num[eTEST_IMPL_NUM_OF] = { 0 };
+
+/**
+ *     Pseudo random generator state
+ */
+static uint32_t g_rand = 1U;
+
+////////////////////////////////////////////////////////////////////////////////
+// Function Prototypes
+////////////////////////////////////////////////////////////////////////////////
+static void     test_event_log  (const test_impl_t impl, const button_num_t num, const bool pressed);
+static uint32_t test_rand       (const uint32_t range);
+static bool     test_seed       (const uint32_t seed, const uint32_t tick_num);
+static bool     test_compare    (const uint32_t seed, const uint32_t tick);
+
+////////////////////////////////////////////////////////////////////////////////
+// Callbacks
+////////////////////////////////////////////////////////////////////////////////
+TEST_CB_DEF( 0, 0 ) TEST_CB_DEF( 0, 1 ) TEST_CB_DEF( 0, 2 ) TEST_CB_DEF( 0, 3 )
+TEST_CB_DEF( 0, 4 ) TEST_CB_DEF( 0, 5 ) TEST_CB_DEF( 0, 6 ) TEST_CB_DEF( 0, 7 )
+TEST_CB_DEF( 1, 0 ) TEST_CB_DEF( 1, 1 ) TEST_CB_DEF( 1, 2 ) TEST_CB_DEF( 1, 3 )
+TEST_CB_DEF( 1, 4 ) TEST_CB_DEF( 1, 5 ) TEST_CB_DEF( 1, 6 ) TEST_CB_DEF( 1, 7 )
+
+/**
+ *     Callbacks of each button for each implementation
+ */
+static const pf_button_callback g_pressed[eBUTTON_NUM_OF][eTEST_IMPL_NUM_OF] =
+{
+    TEST_CB_PRESSED( 0 ), TEST_CB_PRESSED( 1 ), TEST_CB_PRESSED( 2 ), TEST_CB_PRESSED( 3 ),
+    TEST_CB_PRESSED( 4 ), TEST_CB_PRESSED( 5 ), TEST_CB_PRESSED( 6 ), TEST_CB_PRESSED( 7 ),
+};
+
+static const pf_button_callback g_released[eBUTTON_NUM_OF][eTEST_IMPL_NUM_OF] =
+{
+    TEST_CB_RELEASED( 0 ), TEST_CB_RELEASED( 1 ), TEST_CB_RELEASED( 2 ), TEST_CB_RELEASED( 3 ),
+    TEST_CB_RELEASED( 4 ), TEST_CB_RELEASED( 5 ), TEST_CB_RELEASED( 6 ), TEST_CB_RELEASED( 7 ),
+};
+
+_Static_assert( 8 == eBUTTON_NUM_OF );
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Log raised callback
+*
+* @param[in]    impl    - Implementation
+* @param[in]    num     - Button
+* @param[in]    pressed - Pressed or released callback
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_event_log(const test_impl_t impl, const button_num_t num, const bool pressed)
+{
+    if ( g_event_num[impl] < TEST_EVENT_MAX )
+    {
+        g_event[impl][ g_event_num[impl] ].num      = num;
+        g_event[impl][ g_event_num[impl] ].pressed  = pressed;
+    }
+
+    // Overflow is reported as mismatch of number of events
+    g_event_num[impl]++;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get pseudo random number
+*
+* @note     Own generator (xorshift32), so that seeds give the same
+*           sequence on each host.
+*
+* @param[in]    range   - Range of number
+* @return       rand    - Random number from 0 to range-1
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t test_rand(const uint32_t range)
+{
+    g_rand ^= ( g_rand << 13U );
+    g_rand ^= ( g_rand >> 17U );
+    g_rand ^= ( g_rand << 5U );
+
+    return ( g_rand % range );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Compare tested module against reference after handler call
+*
+* @param[in]    seed    - Seed
+* @param[in]    tick    - Handler call number
+* @return       true if both are equal
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool test_compare(const uint32_t seed, const uint32_t tick)
+{
+    bool is_equal = true;
+
+    // Callbacks shall be raised in the same order
+    if ( g_event_num[eTEST_DUT] != g_event_num[eTEST_REF] )
+    {
+        printf( "seed %u, t%u: %u callbacks, reference %u\n", seed, tick, g_event_num[eTEST_DUT], g_event_num[eTEST_REF] );
+        is_equal = false;
+    }
+    else
+    {
+        for ( uint32_t e = 0U; ( e < g_event_num[eTEST_DUT] ) && ( e < TEST_EVENT_MAX ); e++ )
+        {
+            if  (   ( g_event[eTEST_DUT][e].num     != g_event[eTEST_REF][e].num )
+                ||  ( g_event[eTEST_DUT][e].pressed != g_event[eTEST_REF][e].pressed ))
+            {
+                printf( "seed %u, t%u: callback %u of button %d (pressed %d), reference button %d (pressed %d)\n",
+                        seed, tick, e, g_event[eTEST_DUT][e].num, g_event[eTEST_DUT][e].pressed, g_event[eTEST_REF][e].num, g_event[eTEST_REF][e].pressed );
+                is_equal = false;
+            }
+        }
+    }
+
+    for ( button_num_t num = 0; num < eBUTTON_NUM_OF; num++ )
+    {
+        button_state_t  state[eTEST_IMPL_NUM_OF]    = { eBUTTON_UNKNOWN };
+        bool            enable[eTEST_IMPL_NUM_OF]   = { false };
+        float32_t       active[eTEST_IMPL_NUM_OF]   = { 0.0f };
+        float32_t       idle[eTEST_IMPL_NUM_OF]     = { 0.0f };
+
+        (void) button_get_state( num, &state[eTEST_DUT] );
+        (void) button_get_enable( num, &enable[eTEST_DUT] );
+        (void) button_get_time( num, &active[eTEST_DUT], &idle[eTEST_DUT] );
+
+        (void) ref_button_get_state( num, &state[eTEST_REF] );
+        (void) ref_button_get_enable( num, &enable[eTEST_REF] );
+        (void) ref_button_get_time( num, &active[eTEST_REF], &idle[eTEST_REF] );
+
+        #if ( 1 == BUTTON_CFG_COMPACT_EN )
+            active[eTEST_REF]   = fminf( active[eTEST_REF], TEST_TIME_MAX );
+            idle[eTEST_REF]     = fminf( idle[eTEST_REF], TEST_TIME_MAX );
+        #endif
+
+        if  (   ( state[eTEST_DUT] != state[eTEST_REF] )
+            ||  ( enable[eTEST_DUT] != enable[eTEST_REF] )
+            ||  ( fabsf( active[eTEST_DUT] - active[eTEST_REF] ) > TEST_TIME_TOL( active[eTEST_REF] ))
+            ||  ( fabsf( idle[eTEST_DUT] - idle[eTEST_REF] ) > TEST_TIME_TOL( idle[eTEST_REF] )))
+        {
+            printf( "seed %u, t%u, button %d: state %d, enable %d, active %.3f, idle %.3f; reference state %d, enable %d, active %.3f, idle %.3f\n",
+                    seed, tick, num, state[eTEST_DUT], enable[eTEST_DUT], active[eTEST_DUT], idle[eTEST_DUT],
+                    state[eTEST_REF], enable[eTEST_REF], active[eTEST_REF], idle[eTEST_REF] );
+            is_equal = false;
+        }
+    }
+
+    return is_equal;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Run both implementations with single seed
+*
+* @param[in]    seed        - Seed
+* @param[in]    tick_num    - Number of handler calls
+* @return       true if both implementations behave the same
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool test_seed(const uint32_t seed, const uint32_t tick_num)
+{
+    static const float32_t fc[] = { 1.0f, 2.0f, 5.0f, 10.0f, 30.0f };
+
+    bool            is_ok               = true;
+    test_wave_t     wave[eBUTTON_NUM_OF];
+    gpio_state_t    pin[eBUTTON_NUM_OF];
+
+    g_rand = ( seed * 2654435761U ) | 1U;
+
+    for ( button_num_t num = 0; num < eBUTTON_NUM_OF; num++ )
+    {
+        wave[num]   = eTEST_WAVE_SLOW;
+        pin[num]    = eGPIO_LOW;
+        gpio_stub_set( button_cfg_get_table()[num].gpio_pin, pin[num] );
+    }
+
+    if  (   ( eBUTTON_OK != button_init())
+        ||  ( eBUTTON_OK != ref_button_init()))
+    {
+        printf( "seed %u: init failed\n", seed );
+        is_ok = false;
+    }
+
+    for ( uint32_t tick = 0U; ( tick < tick_num ) && ( true == is_ok ); tick++ )
+    {
+        for ( button_num_t num = 0; num < eBUTTON_NUM_OF; num++ )
+        {
+            // Change waveform type
+            if ( 0U == test_rand( 500U ))
+            {
+                wave[num] = (test_wave_t) test_rand( eTEST_WAVE_NUM_OF );
+            }
+
+            switch( wave[num] )
+            {
+                case eTEST_WAVE_BOUNCE:
+                    pin[num] = ( test_rand( 100U ) < 40U ) ? ( eGPIO_HIGH == pin[num] ? eGPIO_LOW : eGPIO_HIGH ) : pin[num];
+                    break;
+
+                case eTEST_WAVE_SLOW:
+                    pin[num] = ( test_rand( 100U ) < 3U ) ? ( eGPIO_HIGH == pin[num] ? eGPIO_LOW : eGPIO_HIGH ) : pin[num];
+                    break;
+
+                case eTEST_WAVE_HOLD:
+                    pin[num] = ( 0U == test_rand( 2000U )) ? ( eGPIO_HIGH == pin[num] ? eGPIO_LOW : eGPIO_HIGH ) : pin[num];
+                    break;
+
+                case eTEST_WAVE_UNKNOWN:
+                default:
+                    pin[num] = (gpio_state_t) test_rand( 3U );
+                    break;
+            }
+
+            gpio_stub_set( button_cfg_get_table()[num].gpio_pin, pin[num] );
+        }
+
+        // Enable toggle
+        if ( 0U == test_rand( 500U ))
+        {
+            const button_num_t num      = (button_num_t) test_rand( eBUTTON_NUM_OF );
+            bool               enable   = false;
+
+            (void) ref_button_get_enable( num, &enable );
+            (void) button_set_enable( num, !enable );
+            (void) ref_button_set_enable( num, !enable );
+        }
+
+        // Callback (un)registration
+        if ( 0U == test_rand( 300U ))
+        {
+            const button_num_t num = (button_num_t) test_rand( eBUTTON_NUM_OF );
+
+            switch( test_rand( 4U ))
+            {
+                case 0U:
+                    (void) button_unregister_callback( num );
+                    (void) ref_button_unregister_callback( num );
+                    break;
+
+                case 1U:
+                    (void) button_register_callback( num, g_pressed[num][eTEST_DUT], NULL );
+                    (void) ref_button_register_callback( num, g_pressed[num][eTEST_REF], NULL );
+                    break;
+
+                case 2U:
+                    (void) button_register_callback( num, NULL, g_released[num][eTEST_DUT] );
+                    (void) ref_button_register_callback( num, NULL, g_released[num][eTEST_REF] );
+                    break;
+
+                default:
+                    (void) button_register_callback( num, g_pressed[num][eTEST_DUT], g_released[num][eTEST_DUT] );
+                    (void) ref_button_register_callback( num, g_pressed[num][eTEST_REF], g_released[num][eTEST_REF] );
+                    break;
+            }
+        }
+
+        // Filter reset or cutoff change
+        if ( 0U == test_rand( 2000U ))
+        {
+            const button_num_t num = (button_num_t) test_rand( eBUTTON_NUM_OF );
+
+            if ( true == button_cfg_get_table()[num].lpf_en )
+            {
+                if ( 0U == test_rand( 2U ))
+                {
+                    (void) button_reset_filter( num );
+                    (void) ref_button_reset_filter( num );
+                }
+                else
+                {
+                    const float32_t fc_new = fc[ test_rand( sizeof( fc ) / sizeof( fc[0] )) ];
+
+                    (void) button_change_filter_fc( num, fc_new );
+                    (void) ref_button_change_filter_fc( num, fc_new );
+                }
+            }
+        }
+
+        g_event_num[eTEST_DUT] = 0U;
+        g_event_num[eTEST_REF] = 0U;
+
+        (void) button_hndl();
+        (void) ref_button_hndl();
+
+        is_ok = test_compare( seed, tick );
+    }
+
+    // Start next seed from scratch
+    (void) button_deinit();
+    ref_button_reset();
+
+    return is_ok;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Differential test entry
+*
+* @param[in]    argc    - Number of arguments
+* @param[in]    argv    - Optional number of seeds and number of ticks
+* @return       0 if all seeds passed
+*/
+////////////////////////////////////////////////////////////////////////////////
+int main(int argc, char * argv[])
+{
+    const uint32_t  seed_num    = ( argc > 1 ) ? (uint32_t) strtoul( argv[1], NULL, 0 ) : TEST_SEED_NUM;
+    const uint32_t  tick_num    = ( argc > 2 ) ? (uint32_t) strtoul( argv[2], NULL, 0 ) : TEST_TICK_NUM;
+    uint32_t        fail_num    = 0U;
+
+    for ( uint32_t seed = 1U; seed <= seed_num; seed++ )
+    {
+        if ( false == test_seed( seed, tick_num ))
+        {
+            fail_num++;
+        }
+    }
+
+    printf( "Differential test: %u of %u seeds (%u ticks) passed\n", ( seed_num - fail_num ), seed_num, tick_num );
+
+    return ( 0U == fail_num ) ? 0 : 1;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
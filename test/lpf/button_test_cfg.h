@@ -0,0 +1,53 @@
+// Copyright (c) 2023 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @file     button_test_cfg.h
+* @brief    Button list & configuration overrides for LPF settle test
+* @author   Ziga Miklosic
+* @email    ziga.miklosic@gmail.com
+* @date     18.10.2026
+* @version  V1.3.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @addtogroup BUTTON_CFG
+* @{ <!-- BEGIN GROUP -->
+*
+*     Included by base test configuration (test/common/button_cfg.h).
+*
+*/
+////////////////////////////////////////////////////////////////////////////////
+#ifndef __BUTTON_TEST_CFG_H_
+#define __BUTTON_TEST_CFG_H_
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *     List of Buttons
+ */
+typedef enum
+{
+    eBUTTON_TEST_0 = 0,         /**<LPF, fc=10 Hz */
+    eBUTTON_TEST_1,             /**<LPF, fc=10 Hz */
+    eBUTTON_TEST_2,             /**<LPF, fc=10 Hz */
+    eBUTTON_TEST_3,             /**<LPF, fc=10 Hz */
+    eBUTTON_TEST_4,             /**<LPF, fc=10 Hz */
+    eBUTTON_TEST_5,             /**<LPF, fc=10 Hz */
+    eBUTTON_TEST_6,             /**<LPF, fc=10 Hz */
+    eBUTTON_TEST_7,             /**<LPF, fc=10 Hz */
+
+    eBUTTON_NUM_OF
+} button_num_t;
+
+
+#endif // __BUTTON_TEST_CFG_H_
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
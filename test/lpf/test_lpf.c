@@ -0,0 +1,265 @@
+// Copyright (c) 2023 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @file     test_lpf.c
+* @brief    LPF settle test
+* @author   Ziga Miklosic
+* @email    ziga.miklosic@gmail.com
+* @date     18.10.2026
+* @version  V1.3.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @addtogroup BUTTON_TEST
+* @{ <!-- BEGIN GROUP -->
+*
+*   Bank of buttons with LPF. Number of filter updates is counted by Filter
+*   stub. Idle bank shall not be processed once filters settle. Edge, cutoff
+*   frequency change and filter reset shall feed only affected filter and
+*   only until it settles again.
+*
+*   Usage: test_lpf
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "button/src/button.h"
+#include "middleware/filter/src/filter.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *     Number of handler calls in one second
+ */
+#define TEST_TICK_PER_S                     ((uint32_t)( 1.0f / BUTTON_CFG_HNDL_PERIOD_S + 0.5f ))
+
+/**
+ *     Filter settle time at fc = 10 Hz: 17 Tao, rounded up
+ *
+ *     Unit: handler calls
+ */
+#define TEST_SETTLE_TICK                    ( 28U )
+
+/**
+ *     Filter detection delay at fc = 10 Hz: 3 Tao, with margin of
+ *     discrete filter
+ *
+ *     Unit: handler calls
+ */
+#define TEST_DETECT_TICK                    ( 10U )
+
+/**
+ *     Check condition and report failure
+ */
+#define TEST_CHECK( cond )                                                          \
+    do                                                                              \
+    {                                                                               \
+        if ( !( cond ))                                                             \
+        {                                                                           \
+            printf( "%s:%d: check failed: %s\n", __func__, __LINE__, #cond );       \
+            gb_is_ok = false;                                                       \
+        }                                                                           \
+    } while ( 0 )
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *     Test result
+ */
+static bool gb_is_ok = true;
+
+////////////////////////////////////////////////////////////////////////////////
+// Function Prototypes
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t         test_run        (const uint32_t tick);
+static button_state_t   test_state      (const button_num_t num);
+static void             test_idle       (void);
+static void             test_edge       (void);
+static void             test_fc         (void);
+static void             test_reset      (void);
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Call button handler
+*
+* @param[in]    tick    - Number of handler calls
+* @return       cnt     - Number of filter updates
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t test_run(const uint32_t tick)
+{
+    const uint32_t cnt = filter_stub_get_hndl_cnt();
+
+    for ( uint32_t i = 0U; i < tick; i++ )
+    {
+        (void) button_hndl();
+    }
+
+    return ( filter_stub_get_hndl_cnt() - cnt );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get button state
+*
+* @param[in]    num     - Button
+* @return       state   - State of button
+*/
+////////////////////////////////////////////////////////////////////////////////
+static button_state_t test_state(const button_num_t num)
+{
+    button_state_t state = eBUTTON_UNKNOWN;
+
+    TEST_CHECK( eBUTTON_OK == button_get_state( num, &state ));
+
+    return state;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Idle bank is not processed after filters settle
+*
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_idle(void)
+{
+    // Startup: all filters settle
+    TEST_CHECK( test_run( TEST_SETTLE_TICK + 2U ) <= ( eBUTTON_NUM_OF * ( TEST_SETTLE_TICK + 2U )));
+    TEST_CHECK( 0U == test_run( TEST_TICK_PER_S ));
+
+    for ( button_num_t num = 0; num < eBUTTON_NUM_OF; num++ )
+    {
+        TEST_CHECK( eBUTTON_OFF == test_state( num ));
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Edge feeds only filter of changed button until it settles
+*
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_edge(void)
+{
+    uint32_t cnt = 0U;
+
+    gpio_stub_set( eGPIO_PIN_3, eGPIO_HIGH );
+
+    // Detected after 3 Tao
+    cnt = test_run( TEST_DETECT_TICK );
+    TEST_CHECK( eBUTTON_ON == test_state( eBUTTON_TEST_3 ));
+
+    // Settled after further 17 Tao, only single filter fed
+    cnt += test_run( TEST_TICK_PER_S );
+    TEST_CHECK(( cnt > TEST_SETTLE_TICK ) && ( cnt <= ( TEST_DETECT_TICK + TEST_SETTLE_TICK )));
+    TEST_CHECK( 0U == test_run( TEST_TICK_PER_S ));
+
+    gpio_stub_set( eGPIO_PIN_3, eGPIO_LOW );
+
+    cnt = test_run( TEST_TICK_PER_S );
+    TEST_CHECK(( cnt > TEST_SETTLE_TICK ) && ( cnt <= ( TEST_DETECT_TICK + TEST_SETTLE_TICK )));
+    TEST_CHECK( 0U == test_run( TEST_TICK_PER_S ));
+
+    for ( button_num_t num = 0; num < eBUTTON_NUM_OF; num++ )
+    {
+        TEST_CHECK( eBUTTON_OFF == test_state( num ));
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Filter settles again to new cutoff frequency
+*
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_fc(void)
+{
+    // Ten times longer settle time
+    TEST_CHECK( eBUTTON_OK == button_change_filter_fc( eBUTTON_TEST_5, 1.0f ));
+
+    TEST_CHECK(( 10U * TEST_SETTLE_TICK ) >= test_run( 5U * TEST_TICK_PER_S ));
+    TEST_CHECK( 0U == test_run( TEST_TICK_PER_S ));
+
+    // Press at 1 Hz is detected after 3 Tao (0.48 sec)
+    gpio_stub_set( eGPIO_PIN_5, eGPIO_HIGH );
+    (void) test_run( 45U );
+    TEST_CHECK( eBUTTON_OFF == test_state( eBUTTON_TEST_5 ));
+    (void) test_run( 5U );
+    TEST_CHECK( eBUTTON_ON == test_state( eBUTTON_TEST_5 ));
+
+    gpio_stub_set( eGPIO_PIN_5, eGPIO_LOW );
+    (void) test_run( 5U * TEST_TICK_PER_S );
+    TEST_CHECK( eBUTTON_OFF == test_state( eBUTTON_TEST_5 ));
+    TEST_CHECK( 0U == test_run( TEST_TICK_PER_S ));
+
+    TEST_CHECK( eBUTTON_OK == button_change_filter_fc( eBUTTON_TEST_5, 10.0f ));
+    (void) test_run( TEST_TICK_PER_S );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Filter settles again after reset
+*
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_reset(void)
+{
+    TEST_CHECK( 0U == test_run( TEST_TICK_PER_S ));
+    TEST_CHECK( eBUTTON_OK == button_reset_filter( eBUTTON_TEST_1 ));
+    TEST_CHECK( TEST_SETTLE_TICK <= test_run( TEST_TICK_PER_S ));
+    TEST_CHECK( 0U == test_run( TEST_TICK_PER_S ));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       LPF settle test entry
+*
+* @return       0 if all checks passed
+*/
+////////////////////////////////////////////////////////////////////////////////
+int main(void)
+{
+    for ( button_num_t num = 0; num < eBUTTON_NUM_OF; num++ )
+    {
+        gpio_stub_set( button_cfg_get_table()[num].gpio_pin, eGPIO_LOW );
+    }
+
+    TEST_CHECK( eBUTTON_OK == button_init());
+
+    test_idle();
+    test_edge();
+    test_fc();
+    test_reset();
+
+    TEST_CHECK( eBUTTON_OK == button_deinit());
+
+    printf( "LPF settle test: %s\n", ( true == gb_is_ok ) ? "passed" : "FAILED" );
+
+    return ( true == gb_is_ok ) ? 0 : 1;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,297 @@
+// Copyright (c) 2023 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @file     test_ovs.c
+* @brief    Oversampled input test
+* @author   Ziga Miklosic
+* @email    ziga.miklosic@gmail.com
+* @date     18.10.2026
+* @version  V1.3.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @addtogroup BUTTON_TEST
+* @{ <!-- BEGIN GROUP -->
+*
+*   GPIO stub cycles pin levels through read pattern of burst length, so
+*   each sample of oversampled input sees whole pattern. Buttons have zero
+*   debounce time, thus state equals result of single sample. State of
+*   oversampled input shall be majority of burst for all patterns, noisy
+*   burst shall not reach oversampled button and burst shall be read only
+*   when button is due.
+*
+*   Usage: test_ovs
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "button/src/button.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *     Number of handler calls in one second
+ */
+#define TEST_TICK_PER_S                     ((uint32_t)( 1.0f / BUTTON_CFG_HNDL_PERIOD_S + 0.5f ))
+
+/**
+ *     Number of reads in burst
+ */
+#define TEST_BURST                          ((uint8_t) BUTTON_CFG_OVERSAMPLE_NUM )
+
+/**
+ *     Number of handler calls of noisy burst check
+ */
+#define TEST_NOISE_TICK                     ( 20U )
+
+/**
+ *     Check condition and report failure
+ */
+#define TEST_CHECK( cond )                                                          \
+    do                                                                              \
+    {                                                                               \
+        if ( !( cond ))                                                             \
+        {                                                                           \
+            printf( "%s:%d: check failed: %s\n", __func__, __LINE__, #cond );       \
+            gb_is_ok = false;                                                       \
+        }                                                                           \
+    } while ( 0 )
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *     Test result
+ */
+static bool gb_is_ok = true;
+
+////////////////////////////////////////////////////////////////////////////////
+// Function Prototypes
+////////////////////////////////////////////////////////////////////////////////
+static void             test_run        (const uint32_t tick);
+static button_state_t   test_state      (const button_num_t num);
+static void             test_pattern    (const button_num_t num, const uint32_t pattern);
+static void             test_vote       (void);
+static void             test_noise      (void);
+static void             test_due        (void);
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Call button handler
+*
+* @param[in]    tick    - Number of handler calls
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_run(const uint32_t tick)
+{
+    for ( uint32_t i = 0U; i < tick; i++ )
+    {
+        (void) button_hndl();
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get button state
+*
+* @param[in]    num     - Button
+* @return       state   - State of button
+*/
+////////////////////////////////////////////////////////////////////////////////
+static button_state_t test_state(const button_num_t num)
+{
+    button_state_t state = eBUTTON_UNKNOWN;
+
+    TEST_CHECK( eBUTTON_OK == button_get_state( num, &state ));
+
+    return state;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Set read pattern of button input
+*
+* @param[in]    num     - Button
+* @param[in]    pattern - Levels of reads in burst, bit set when high
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_pattern(const button_num_t num, const uint32_t pattern)
+{
+    gpio_stub_set_pattern( button_cfg_get_table()[num].gpio_pin, pattern, TEST_BURST );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       State is majority of reads for all burst patterns
+*
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_vote(void)
+{
+    for ( uint32_t pattern = 0U; pattern < ( 1UL << TEST_BURST ); pattern++ )
+    {
+        const uint32_t  high    = (uint32_t) __builtin_popcount( pattern );
+        const uint32_t  cnt     = gpio_stub_get_read_cnt( eGPIO_PIN_0 );
+
+        test_pattern( eBUTTON_TEST_0, pattern );
+        test_pattern( eBUTTON_TEST_1, pattern );
+        test_run( 1U );
+
+        TEST_CHECK(( cnt + TEST_BURST ) == gpio_stub_get_read_cnt( eGPIO_PIN_0 ));
+
+        if  (   ((( 2U * high ) > TEST_BURST ) ? eBUTTON_ON : eBUTTON_OFF ) != test_state( eBUTTON_TEST_0 )
+            ||  ((( 2U * high ) < TEST_BURST ) ? eBUTTON_ON : eBUTTON_OFF ) != test_state( eBUTTON_TEST_1 ))
+        {
+            printf( "pattern 0x%02X: wrong majority vote\n", pattern );
+            gb_is_ok = false;
+        }
+    }
+
+    gpio_stub_set( eGPIO_PIN_0, eGPIO_LOW );
+    gpio_stub_set( eGPIO_PIN_1, eGPIO_HIGH );
+    test_run( 1U );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Noisy burst changes only state of not oversampled input
+*
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_noise(void)
+{
+    // Single glitch of idle input
+    const uint32_t  idle_glitch     = 0x04U;
+
+    // Single glitch of active input
+    const uint32_t  active_glitch   = (( 1UL << TEST_BURST ) - 1U ) & ~0x04UL;
+
+    uint32_t        change          = 0U;
+
+    test_pattern( eBUTTON_TEST_0, idle_glitch );
+    test_pattern( eBUTTON_TEST_2, idle_glitch );
+
+    for ( uint32_t i = 0U; i < TEST_NOISE_TICK; i++ )
+    {
+        test_run( 1U );
+
+        TEST_CHECK( eBUTTON_OFF == test_state( eBUTTON_TEST_0 ));
+
+        if ( eBUTTON_ON == test_state( eBUTTON_TEST_2 ))
+        {
+            change++;
+        }
+    }
+
+    // Single read of not oversampled input hits glitch once per burst length
+    TEST_CHECK(( TEST_NOISE_TICK / TEST_BURST ) == change );
+
+    change = 0U;
+
+    test_pattern( eBUTTON_TEST_0, active_glitch );
+    test_pattern( eBUTTON_TEST_2, active_glitch );
+
+    for ( uint32_t i = 0U; i < TEST_NOISE_TICK; i++ )
+    {
+        test_run( 1U );
+
+        TEST_CHECK( eBUTTON_ON == test_state( eBUTTON_TEST_0 ));
+
+        if ( eBUTTON_OFF == test_state( eBUTTON_TEST_2 ))
+        {
+            change++;
+        }
+    }
+
+    TEST_CHECK(( TEST_NOISE_TICK / TEST_BURST ) == change );
+
+    gpio_stub_set( eGPIO_PIN_0, eGPIO_LOW );
+    gpio_stub_set( eGPIO_PIN_2, eGPIO_LOW );
+    test_run( 1U );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Burst is read only when button is due
+*
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_due(void)
+{
+    const uint32_t cnt_2 = gpio_stub_get_read_cnt( eGPIO_PIN_2 );
+    const uint32_t cnt_3 = gpio_stub_get_read_cnt( eGPIO_PIN_3 );
+
+    test_run( 10U );
+
+    TEST_CHECK(( cnt_2 + 10U ) == gpio_stub_get_read_cnt( eGPIO_PIN_2 ));
+    TEST_CHECK(( cnt_3 + ( 5U * TEST_BURST )) == gpio_stub_get_read_cnt( eGPIO_PIN_3 ));
+
+    // Majority of burst sampled at each second call
+    test_pattern( eBUTTON_TEST_3, 0x07U );
+    test_run( 2U );
+    TEST_CHECK( eBUTTON_ON == test_state( eBUTTON_TEST_3 ));
+
+    test_pattern( eBUTTON_TEST_3, 0x03U );
+    test_run( 2U );
+    TEST_CHECK( eBUTTON_OFF == test_state( eBUTTON_TEST_3 ));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Oversampled input test entry
+*
+* @return       0 if all checks passed
+*/
+////////////////////////////////////////////////////////////////////////////////
+int main(void)
+{
+    gpio_stub_set( eGPIO_PIN_0, eGPIO_LOW );
+    gpio_stub_set( eGPIO_PIN_1, eGPIO_HIGH );
+    gpio_stub_set( eGPIO_PIN_2, eGPIO_LOW );
+    gpio_stub_set( eGPIO_PIN_3, eGPIO_LOW );
+
+    TEST_CHECK( eBUTTON_OK == button_init());
+
+    test_run( TEST_TICK_PER_S );
+
+    for ( button_num_t num = 0; num < eBUTTON_NUM_OF; num++ )
+    {
+        TEST_CHECK( eBUTTON_OFF == test_state( num ));
+    }
+
+    test_vote();
+    test_noise();
+    test_due();
+
+    TEST_CHECK( eBUTTON_OK == button_deinit());
+
+    printf( "Oversampling test: %s\n", ( true == gb_is_ok ) ? "passed" : "FAILED" );
+
+    return ( true == gb_is_ok ) ? 0 : 1;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
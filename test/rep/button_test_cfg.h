@@ -0,0 +1,55 @@
+// Copyright (c) 2023 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @file     button_test_cfg.h
+* @brief    Button list & configuration overrides for auto-repeat test
+* @author   Ziga Miklosic
+* @email    ziga.miklosic@gmail.com
+* @date     18.10.2026
+* @version  V1.3.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @addtogroup BUTTON_CFG
+* @{ <!-- BEGIN GROUP -->
+*
+*     Included by base test configuration (test/common/button_cfg.h).
+*
+*/
+////////////////////////////////////////////////////////////////////////////////
+#ifndef __BUTTON_TEST_CFG_H_
+#define __BUTTON_TEST_CFG_H_
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *     List of Buttons
+ */
+typedef enum
+{
+    eBUTTON_TEST_0 = 0,         /**<Repeat after 0.5 sec, every 0.2 sec */
+    eBUTTON_TEST_1,             /**<Repeat after 0.3 sec, from 0.2 sec accelerating down to 0.05 sec */
+    eBUTTON_TEST_2,             /**<Repeat after 0.1 sec, every 0.1 sec */
+    eBUTTON_TEST_3,             /**<Repeat after 0.2 sec, every 0.3 sec */
+    eBUTTON_TEST_4,             /**<No repeat */
+
+    eBUTTON_NUM_OF
+} button_num_t;
+
+/**
+ *     Configuration overrides
+ */
+#define BUTTON_CFG_REPEAT_EN                ( 1 )
+#define BUTTON_CFG_RUNTIME_CFG_EN           ( 1 )
+
+#endif // __BUTTON_TEST_CFG_H_
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,456 @@
+// Copyright (c) 2023 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @file     test_rep.c
+* @brief    Auto-repeat test
+* @author   Ziga Miklosic
+* @email    ziga.miklosic@gmail.com
+* @date     18.10.2026
+* @version  V1.3.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @addtogroup BUTTON_TEST
+* @{ <!-- BEGIN GROUP -->
+*
+*   Buttons with different repeat delay, period and acceleration are held
+*   together. Pressed callbacks are logged with handler call number. Each
+*   button shall repeat at its own schedule, repeats of all buttons shall
+*   be reported in order of due time, and repeat shall stop on release and
+*   on reconfiguration of button.
+*
+*   Usage: test_rep
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "button/src/button.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *     Number of handler calls in one second
+ */
+#define TEST_TICK_PER_S                     ((uint32_t)( 1.0f / BUTTON_CFG_HNDL_PERIOD_S + 0.5f ))
+
+/**
+ *     Size of callback log
+ */
+#define TEST_LOG_SIZE                       ( 256U )
+
+/**
+ *     Maximum number of expected repeats in schedule
+ */
+#define TEST_SCHED_MAX                      ( 16U )
+
+/**
+ *     Check condition and report failure
+ */
+#define TEST_CHECK( cond )                                                          \
+    do                                                                              \
+    {                                                                               \
+        if ( !( cond ))                                                             \
+        {                                                                           \
+            printf( "%s:%d: check failed: %s\n", __func__, __LINE__, #cond );       \
+            gb_is_ok = false;                                                       \
+        }                                                                           \
+    } while ( 0 )
+
+/**
+ *     Logged pressed callback
+ */
+typedef struct
+{
+    uint32_t        tick;   /**<Handler call number */
+    button_num_t    num;    /**<Button */
+} test_log_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *     Test result
+ */
+static bool gb_is_ok = true;
+
+/**
+ *     Handler call number
+ */
+static uint32_t g_tick = 0U;
+
+/**
+ *     Callback log
+ */
+static test_log_t   g_log[TEST_LOG_SIZE] = { 0 };
+static uint32_t     g_log_num = 0U;
+
+/**
+ *     Expected repeats within first second of hold, relative to press.
+ *     Zero terminated.
+ *
+ *     Unit: handler calls
+ */
+static const uint32_t g_sched[eBUTTON_NUM_OF][TEST_SCHED_MAX] =
+{
+    [eBUTTON_TEST_0] = { 50U, 70U, 90U },
+    [eBUTTON_TEST_1] = { 30U, 50U, 60U, 65U, 70U, 75U, 80U, 85U, 90U, 95U },
+    [eBUTTON_TEST_2] = { 10U, 20U, 30U, 40U, 50U, 60U, 70U, 80U, 90U },
+    [eBUTTON_TEST_3] = { 20U, 50U, 80U },
+    [eBUTTON_TEST_4] = { 0U },
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Function Prototypes
+////////////////////////////////////////////////////////////////////////////////
+static void             test_log        (const button_num_t num);
+static void             test_pressed_0  (void);
+static void             test_pressed_1  (void);
+static void             test_pressed_2  (void);
+static void             test_pressed_3  (void);
+static void             test_pressed_4  (void);
+static void             test_run        (const uint32_t tick);
+static void             test_set        (const button_num_t num, const bool active);
+static uint32_t         test_cnt        (const button_num_t num, const uint32_t from);
+static void             test_schedule   (const button_num_t num, const uint32_t press);
+static void             test_hold       (void);
+static void             test_release    (void);
+static void             test_reconfig   (void);
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Log pressed callback
+*
+* @param[in]    num     - Button
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_log(const button_num_t num)
+{
+    if ( g_log_num < TEST_LOG_SIZE )
+    {
+        g_log[g_log_num].tick   = g_tick;
+        g_log[g_log_num].num    = num;
+        g_log_num++;
+    }
+    else
+    {
+        gb_is_ok = false;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Button 0 pressed or repeated
+*
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_pressed_0(void)
+{
+    test_log( eBUTTON_TEST_0 );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Button 1 pressed or repeated
+*
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_pressed_1(void)
+{
+    test_log( eBUTTON_TEST_1 );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Button 2 pressed or repeated
+*
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_pressed_2(void)
+{
+    test_log( eBUTTON_TEST_2 );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Button 3 pressed or repeated
+*
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_pressed_3(void)
+{
+    test_log( eBUTTON_TEST_3 );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Button 4 pressed or repeated
+*
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_pressed_4(void)
+{
+    test_log( eBUTTON_TEST_4 );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Call button handler
+*
+* @param[in]    tick    - Number of handler calls
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_run(const uint32_t tick)
+{
+    for ( uint32_t i = 0U; i < tick; i++ )
+    {
+        g_tick++;
+        (void) button_hndl();
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Set button input
+*
+* @param[in]    num     - Button
+* @param[in]    active  - Input active
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_set(const button_num_t num, const bool active)
+{
+    gpio_stub_set( button_cfg_get_table()[num].gpio_pin, ( true == active ) ? eGPIO_HIGH : eGPIO_LOW );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Count logged callbacks of button
+*
+* @param[in]    num     - Button
+* @param[in]    from    - First handler call number
+* @return       cnt     - Number of callbacks since "from"
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t test_cnt(const button_num_t num, const uint32_t from)
+{
+    uint32_t cnt = 0U;
+
+    for ( uint32_t i = 0U; i < g_log_num; i++ )
+    {
+        if  (   ( num == g_log[i].num )
+            &&  ( g_log[i].tick >= from ))
+        {
+            cnt++;
+        }
+    }
+
+    return cnt;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Compare logged callbacks of button against expected schedule
+*
+* @param[in]    num     - Button
+* @param[in]    press   - Handler call number of press
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_schedule(const button_num_t num, const uint32_t press)
+{
+    uint32_t s = 0U;
+
+    for ( uint32_t i = 0U; i < g_log_num; i++ )
+    {
+        if  (   ( num == g_log[i].num )
+            &&  ( g_log[i].tick > press ))
+        {
+            if  (   ( s >= TEST_SCHED_MAX )
+                ||  ( g_log[i].tick != ( press + g_sched[num][s] )))
+            {
+                printf( "button %d: repeat %u at %u calls after press, expected %u\n",
+                        num, s, ( g_log[i].tick - press ), ( s < TEST_SCHED_MAX ) ? g_sched[num][s] : 0U );
+                gb_is_ok = false;
+            }
+
+            s++;
+        }
+    }
+
+    // All expected repeats reported
+    TEST_CHECK(( s >= TEST_SCHED_MAX ) || ( 0U == g_sched[num][s] ));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Held buttons repeat at own schedules in order of due time
+*
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_hold(void)
+{
+    const uint32_t press = ( g_tick + 1U );
+
+    g_log_num = 0U;
+
+    for ( button_num_t num = 0; num < eBUTTON_NUM_OF; num++ )
+    {
+        test_set( num, true );
+    }
+
+    test_run( TEST_TICK_PER_S );
+
+    // Single press of each button
+    for ( button_num_t num = 0; num < eBUTTON_NUM_OF; num++ )
+    {
+        TEST_CHECK(( test_cnt( num, press ) - test_cnt( num, ( press + 1U ))) == 1U );
+
+        test_schedule( num, press );
+    }
+
+    // Reported in order of due time
+    for ( uint32_t i = 1U; i < g_log_num; i++ )
+    {
+        TEST_CHECK( g_log[i-1U].tick <= g_log[i].tick );
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Release stops repeat of released button only
+*
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_release(void)
+{
+    const uint32_t from = ( g_tick + 1U );
+
+    test_set( eBUTTON_TEST_2, false );
+    test_run( TEST_TICK_PER_S );
+
+    TEST_CHECK( 0U == test_cnt( eBUTTON_TEST_2, from ));
+    TEST_CHECK( 0U == test_cnt( eBUTTON_TEST_4, from ));
+
+    // Further second at 0.2 sec period
+    TEST_CHECK( 5U == test_cnt( eBUTTON_TEST_0, from ));
+
+    // At minimum period of 0.05 sec
+    TEST_CHECK( 20U == test_cnt( eBUTTON_TEST_1, from ));
+
+    // 0.3 sec period
+    TEST_CHECK( 3U == test_cnt( eBUTTON_TEST_3, from ));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Reconfiguration of held button stops its repeat and new configuration
+*       applies to next press
+*
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_reconfig(void)
+{
+    button_cfg_t    cfg     = { 0 };
+    uint32_t        from    = 0U;
+    uint32_t        press   = 0U;
+
+    TEST_CHECK( eBUTTON_OK == button_get_cfg( eBUTTON_TEST_0, &cfg ));
+    cfg.rep_period = 0.1f;
+    TEST_CHECK( eBUTTON_OK == button_set_cfg( eBUTTON_TEST_0, &cfg ));
+
+    from = ( g_tick + 1U );
+    test_run( TEST_TICK_PER_S );
+
+    // Still held, restarted button is not pressed again
+    TEST_CHECK( 0U == test_cnt( eBUTTON_TEST_0, from ));
+    TEST_CHECK( 0U < test_cnt( eBUTTON_TEST_1, from ));
+
+    // Release all
+    for ( button_num_t num = 0; num < eBUTTON_NUM_OF; num++ )
+    {
+        test_set( num, false );
+    }
+
+    test_run( TEST_TICK_PER_S );
+
+    // New period on next press
+    g_log_num   = 0U;
+    press       = ( g_tick + 1U );
+
+    test_set( eBUTTON_TEST_0, true );
+    test_run( 75U );
+
+    TEST_CHECK( 4U == g_log_num );
+    TEST_CHECK( press == g_log[0].tick );
+    TEST_CHECK(( press + 50U ) == g_log[1].tick );
+    TEST_CHECK(( press + 60U ) == g_log[2].tick );
+    TEST_CHECK(( press + 70U ) == g_log[3].tick );
+
+    test_set( eBUTTON_TEST_0, false );
+    test_run( 1U );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Auto-repeat test entry
+*
+* @return       0 if all checks passed
+*/
+////////////////////////////////////////////////////////////////////////////////
+int main(void)
+{
+    for ( button_num_t num = 0; num < eBUTTON_NUM_OF; num++ )
+    {
+        test_set( num, false );
+    }
+
+    TEST_CHECK( eBUTTON_OK == button_init());
+    TEST_CHECK( eBUTTON_OK == button_register_callback( eBUTTON_TEST_0, test_pressed_0, NULL ));
+    TEST_CHECK( eBUTTON_OK == button_register_callback( eBUTTON_TEST_1, test_pressed_1, NULL ));
+    TEST_CHECK( eBUTTON_OK == button_register_callback( eBUTTON_TEST_2, test_pressed_2, NULL ));
+    TEST_CHECK( eBUTTON_OK == button_register_callback( eBUTTON_TEST_3, test_pressed_3, NULL ));
+    TEST_CHECK( eBUTTON_OK == button_register_callback( eBUTTON_TEST_4, test_pressed_4, NULL ));
+
+    test_run( TEST_TICK_PER_S );
+
+    test_hold();
+    test_release();
+    test_reconfig();
+
+    TEST_CHECK( eBUTTON_OK == button_deinit());
+
+    printf( "Auto-repeat test: %s\n", ( true == gb_is_ok ) ? "passed" : "FAILED" );
+
+    return ( true == gb_is_ok ) ? 0 : 1;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,225 @@
+// Copyright (c) 2023 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @file     test_seq.c
+* @brief    Press sequence recognizer test
+* @author   Ziga Miklosic
+* @email    ziga.miklosic@gmail.com
+* @date     18.10.2026
+* @version  V1.3.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @addtogroup BUTTON_TEST
+* @{ <!-- BEGIN GROUP -->
+*
+*   Two sequences share prefix, but have different step timeouts:
+*   HOME,OPEN (1 sec) and HOME,OPEN,CLOSE (5 sec). Each sequence shall be
+*   completed only if all its steps are within its own step timeout.
+*
+*   Usage: test_seq
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "button/src/button.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *     Number of handler calls in one second
+ */
+#define TEST_TICK_PER_S                     ((uint32_t)( 1.0f / BUTTON_CFG_HNDL_PERIOD_S + 0.5f ))
+
+/**
+ *     Press time
+ *
+ *     Unit: handler calls
+ */
+#define TEST_PRESS_TICK                     ( 10U )
+
+/**
+ *     Check condition and report failure
+ */
+#define TEST_CHECK( cond )                                                          \
+    do                                                                              \
+    {                                                                               \
+        if ( !( cond ))                                                             \
+        {                                                                           \
+            printf( "%s:%d: check failed: %s\n", __func__, __LINE__, #cond );       \
+            gb_is_ok = false;                                                       \
+        }                                                                           \
+    } while ( 0 )
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *     Test result
+ */
+static bool gb_is_ok = true;
+
+/**
+ *     Number of completed sequences
+ */
+static uint32_t g_short_cnt = 0U;
+static uint32_t g_long_cnt  = 0U;
+
+////////////////////////////////////////////////////////////////////////////////
+// Function Prototypes
+////////////////////////////////////////////////////////////////////////////////
+static void test_short_done (void);
+static void test_long_done  (void);
+static void test_run        (const uint32_t tick);
+static void test_press      (const button_num_t num, const float32_t gap_s);
+static void test_case       (const float32_t gap_1_s, const float32_t gap_2_s, const uint32_t short_cnt, const uint32_t long_cnt);
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       HOME,OPEN completed
+*
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_short_done(void)
+{
+    g_short_cnt++;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       HOME,OPEN,CLOSE completed
+*
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_long_done(void)
+{
+    g_long_cnt++;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Call button handler
+*
+* @param[in]    tick    - Number of handler calls
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_run(const uint32_t tick)
+{
+    for ( uint32_t i = 0U; i < tick; i++ )
+    {
+        (void) button_hndl();
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Wait and press button
+*
+* @param[in]    num     - Button
+* @param[in]    gap_s   - Time from previous press. Unit: sec
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_press(const button_num_t num, const float32_t gap_s)
+{
+    test_run((uint32_t)( gap_s * (float32_t) TEST_TICK_PER_S ) - TEST_PRESS_TICK );
+
+    gpio_stub_set( button_cfg_get_table()[num].gpio_pin, eGPIO_HIGH );
+    test_run( TEST_PRESS_TICK );
+    gpio_stub_set( button_cfg_get_table()[num].gpio_pin, eGPIO_LOW );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Press HOME, OPEN & CLOSE and check completed sequences
+*
+* @param[in]    gap_1_s     - Time between HOME & OPEN. Unit: sec
+* @param[in]    gap_2_s     - Time between OPEN & CLOSE. Unit: sec
+* @param[in]    short_cnt   - Expected completions of HOME,OPEN
+* @param[in]    long_cnt    - Expected completions of HOME,OPEN,CLOSE
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_case(const float32_t gap_1_s, const float32_t gap_2_s, const uint32_t short_cnt, const uint32_t long_cnt)
+{
+    g_short_cnt = 0U;
+    g_long_cnt  = 0U;
+
+    // Recognizer starts over
+    test_run( 10U * TEST_TICK_PER_S );
+
+    test_press( eBUTTON_TEST_HOME, 1.0f );
+    test_press( eBUTTON_TEST_OPEN, gap_1_s );
+    test_press( eBUTTON_TEST_CLOSE, gap_2_s );
+
+    if  (   ( short_cnt != g_short_cnt )
+        ||  ( long_cnt != g_long_cnt ))
+    {
+        printf( "gaps %.1f & %.1f sec: HOME,OPEN %u (expected %u), HOME,OPEN,CLOSE %u (expected %u)\n",
+                gap_1_s, gap_2_s, g_short_cnt, short_cnt, g_long_cnt, long_cnt );
+        gb_is_ok = false;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Press sequence test entry
+*
+* @return       0 if all checks passed
+*/
+////////////////////////////////////////////////////////////////////////////////
+int main(void)
+{
+    const button_num_t short_seq[]  = { eBUTTON_TEST_HOME, eBUTTON_TEST_OPEN };
+    const button_num_t long_seq[]   = { eBUTTON_TEST_HOME, eBUTTON_TEST_OPEN, eBUTTON_TEST_CLOSE };
+
+    for ( button_num_t num = 0; num < eBUTTON_NUM_OF; num++ )
+    {
+        gpio_stub_set( button_cfg_get_table()[num].gpio_pin, eGPIO_LOW );
+    }
+
+    TEST_CHECK( eBUTTON_OK == button_init());
+    TEST_CHECK( eBUTTON_OK == button_seq_register( short_seq, 2U, 1.0f, test_short_done, NULL ));
+    TEST_CHECK( eBUTTON_OK == button_seq_register( long_seq, 3U, 5.0f, test_long_done, NULL ));
+
+    // Both sequences in time
+    test_case( 0.5f, 0.5f, 1U, 1U );
+
+    // Short sequence step timeout elapsed, long one continues
+    test_case( 4.0f, 0.5f, 0U, 1U );
+    test_case( 4.0f, 4.0f, 0U, 1U );
+
+    // Long sequence step timeout elapsed
+    test_case( 0.5f, 6.0f, 1U, 0U );
+    test_case( 6.0f, 0.5f, 0U, 0U );
+
+    TEST_CHECK( eBUTTON_OK == button_deinit());
+
+    printf( "Press sequence test: %s\n", ( true == gb_is_ok ) ? "passed" : "FAILED" );
+
+    return ( true == gb_is_ok ) ? 0 : 1;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
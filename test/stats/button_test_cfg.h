@@ -0,0 +1,64 @@
+// Copyright (c) 2023 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @file     button_test_cfg.h
+* @brief    Button list & configuration overrides for statistics test
+* @author   Ziga Miklosic
+* @email    ziga.miklosic@gmail.com
+* @date     18.10.2026
+* @version  V1.3.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @addtogroup BUTTON_CFG
+* @{ <!-- BEGIN GROUP -->
+*
+*     Included by base test configuration (test/common/button_cfg.h).
+*
+*/
+////////////////////////////////////////////////////////////////////////////////
+#ifndef __BUTTON_TEST_CFG_H_
+#define __BUTTON_TEST_CFG_H_
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *     List of Buttons
+ */
+typedef enum
+{
+    eBUTTON_TEST_0 = 0,         /**<Delay debounce, active high */
+    eBUTTON_TEST_1,             /**<Eager debounce, active low */
+    eBUTTON_TEST_IDLE,          /**<First of idle buttons, stretching timing sweep over press time */
+
+    eBUTTON_NUM_OF = ( eBUTTON_TEST_IDLE + 1000 )
+} button_num_t;
+
+/**
+ *     Configuration overrides
+ */
+#define BUTTON_CFG_STATS_EN                 ( 1 )
+#define BUTTON_CFG_STATS_FLUSH_EVENTS       ( 10U )
+#define BUTTON_CFG_STATS_FLUSH_PERIOD_S     ( 10.0f )
+#define BUTTON_CFG_RAM_BUDGET               ( 65536U )
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+// NVM mock control
+void     button_cfg_stats_set_file      (const char * const p_file);
+void     button_cfg_stats_set_fail      (const bool fail);
+uint32_t button_cfg_stats_get_store_cnt (void);
+
+#endif // __BUTTON_TEST_CFG_H_
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,482 @@
+// Copyright (c) 2023 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @file     test_stats.c
+* @brief    Button statistics test with file-backed NVM mock
+* @author   Ziga Miklosic
+* @email    ziga.miklosic@gmail.com
+* @date     18.10.2026
+* @version  V1.3.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @addtogroup BUTTON_TEST
+* @{ <!-- BEGIN GROUP -->
+*
+*   Statistics are stored into file by "button_cfg_stats_load/store" mock
+*   (see "button_cfg.c"). Test covers persistence over re-initialization,
+*   invalid NVM content, store gating after failed NVM write and active
+*   time of long presses, also while button is still held and when module
+*   is de-initialized during press.
+*
+*   Usage: test_stats [statistics file]
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "button/src/button.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *     Default statistics file
+ */
+#ifndef TEST_STATS_FILE
+    #define TEST_STATS_FILE                 "button_stats.bin"
+#endif
+
+/**
+ *     Number of handler calls in one second
+ */
+#define TEST_TICK_PER_S                     ((uint32_t)( 1.0f / BUTTON_CFG_HNDL_PERIOD_S + 0.5f ))
+
+/**
+ *     Check condition and report failure
+ */
+#define TEST_CHECK( cond )                                                          \
+    do                                                                              \
+    {                                                                               \
+        if ( !( cond ))                                                             \
+        {                                                                           \
+            printf( "%s:%d: check failed: %s\n", __func__, __LINE__, #cond );       \
+            gb_is_ok = false;                                                       \
+        }                                                                           \
+    } while ( 0 )
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *     Test result
+ */
+static bool gb_is_ok = true;
+
+/**
+ *     Statistics file
+ */
+static const char * gp_file = TEST_STATS_FILE;
+
+////////////////////////////////////////////////////////////////////////////////
+// Function Prototypes
+////////////////////////////////////////////////////////////////////////////////
+static void             test_run        (const uint32_t tick);
+static void             test_set        (const button_num_t num, const bool active);
+static void             test_press      (const button_num_t num, const uint32_t hold, const uint32_t gap);
+static button_stats_t   test_get        (const button_num_t num);
+static void             test_init       (void);
+static void             test_persist    (void);
+static void             test_corrupt    (void);
+static void             test_fail       (void);
+static void             test_hold       (void);
+static void             test_held       (void);
+static void             test_deinit     (void);
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Call button handler
+*
+* @param[in]    tick    - Number of handler calls
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_run(const uint32_t tick)
+{
+    for ( uint32_t i = 0U; i < tick; i++ )
+    {
+        (void) button_hndl();
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Set button input
+*
+* @param[in]    num     - Button
+* @param[in]    active  - Input active (pressed)
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_set(const button_num_t num, const bool active)
+{
+    const button_cfg_t * const p_cfg = &button_cfg_get_table()[num];
+    const bool high = ( active == ( eBUTTON_POL_ACTIVE_HIGH == p_cfg->polarity ));
+
+    gpio_stub_set( p_cfg->gpio_pin, ( true == high ) ? eGPIO_HIGH : eGPIO_LOW );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Press & release button
+*
+* @param[in]    num     - Button
+* @param[in]    hold    - Press time. Unit: handler calls
+* @param[in]    gap     - Release time. Unit: handler calls
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_press(const button_num_t num, const uint32_t hold, const uint32_t gap)
+{
+    test_set( num, true );
+    test_run( hold );
+    test_set( num, false );
+    test_run( gap );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get button statistics
+*
+* @param[in]    num     - Button
+* @return       stats   - Statistics of button
+*/
+////////////////////////////////////////////////////////////////////////////////
+static button_stats_t test_get(const button_num_t num)
+{
+    button_stats_t stats = { .press_cnt = 0xFFFFFFFFU, .active_s = 0xFFFFFFFFU };
+
+    TEST_CHECK( eBUTTON_OK == button_get_stats( num, &stats ));
+
+    return stats;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Release all inputs and initialize module
+*
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_init(void)
+{
+    for ( button_num_t num = 0; num < eBUTTON_NUM_OF; num++ )
+    {
+        test_set( num, false );
+    }
+
+    TEST_CHECK( eBUTTON_OK == button_init());
+
+    // Settle startup state
+    test_run( TEST_TICK_PER_S );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Statistics are kept over re-initialization
+*
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_persist(void)
+{
+    (void) remove( gp_file );
+
+    test_init();
+
+    TEST_CHECK( 0U == test_get( eBUTTON_TEST_0 ).press_cnt );
+    TEST_CHECK( 0U == test_get( eBUTTON_TEST_1 ).press_cnt );
+
+    // 5x 0.5 sec & 3x 0.5 sec
+    for ( uint32_t i = 0U; i < 5U; i++ )
+    {
+        test_press( eBUTTON_TEST_0, ( TEST_TICK_PER_S / 2U ), ( TEST_TICK_PER_S / 2U ));
+    }
+    for ( uint32_t i = 0U; i < 3U; i++ )
+    {
+        test_press( eBUTTON_TEST_1, ( TEST_TICK_PER_S / 2U ), ( TEST_TICK_PER_S / 2U ));
+    }
+
+    TEST_CHECK( 5U == test_get( eBUTTON_TEST_0 ).press_cnt );
+    TEST_CHECK( 2U == test_get( eBUTTON_TEST_0 ).active_s );
+    TEST_CHECK( 3U == test_get( eBUTTON_TEST_1 ).press_cnt );
+    TEST_CHECK( 1U == test_get( eBUTTON_TEST_1 ).active_s );
+
+    // Unstored events are stored at de-initialization
+    const uint32_t store_cnt = button_cfg_stats_get_store_cnt();
+
+    TEST_CHECK( eBUTTON_OK == button_deinit());
+    TEST_CHECK(( store_cnt + 1U ) == button_cfg_stats_get_store_cnt());
+
+    test_init();
+
+    TEST_CHECK( 5U == test_get( eBUTTON_TEST_0 ).press_cnt );
+    TEST_CHECK( 2U == test_get( eBUTTON_TEST_0 ).active_s );
+    TEST_CHECK( 3U == test_get( eBUTTON_TEST_1 ).press_cnt );
+    TEST_CHECK( 1U == test_get( eBUTTON_TEST_1 ).active_s );
+
+    TEST_CHECK( eBUTTON_OK == button_deinit());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Statistics start from zero on corrupted NVM
+*
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_corrupt(void)
+{
+    uint8_t buf[256];
+    size_t  size = 0U;
+    FILE *  p_file = NULL;
+
+    test_persist();
+
+    // Flip single bit of stored record
+    p_file = fopen( gp_file, "rb" );
+    TEST_CHECK( NULL != p_file );
+
+    if ( NULL != p_file )
+    {
+        size = fread( buf, 1U, sizeof( buf ), p_file );
+        (void) fclose( p_file );
+    }
+
+    TEST_CHECK( size > 8U );
+
+    if ( size > 8U )
+    {
+        buf[8] ^= 0x01U;
+
+        p_file = fopen( gp_file, "wb" );
+        TEST_CHECK( NULL != p_file );
+
+        if ( NULL != p_file )
+        {
+            TEST_CHECK( size == fwrite( buf, 1U, size, p_file ));
+            (void) fclose( p_file );
+        }
+    }
+
+    test_init();
+
+    TEST_CHECK( 0U == test_get( eBUTTON_TEST_0 ).press_cnt );
+    TEST_CHECK( 0U == test_get( eBUTTON_TEST_0 ).active_s );
+    TEST_CHECK( 0U == test_get( eBUTTON_TEST_1 ).press_cnt );
+    TEST_CHECK( 0U == test_get( eBUTTON_TEST_1 ).active_s );
+
+    TEST_CHECK( eBUTTON_OK == button_deinit());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Failed store is retried only after flush period
+*
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_fail(void)
+{
+    const uint32_t  period  = (uint32_t)( BUTTON_CFG_STATS_FLUSH_PERIOD_S * TEST_TICK_PER_S );
+    uint32_t        base    = 0U;
+
+    (void) remove( gp_file );
+
+    test_init();
+
+    base = button_cfg_stats_get_store_cnt();
+    button_cfg_stats_set_fail( true );
+
+    // Enough events for store
+    for ( uint32_t i = 0U; i < BUTTON_CFG_STATS_FLUSH_EVENTS; i++ )
+    {
+        test_press( eBUTTON_TEST_0, 10U, 10U );
+    }
+
+    TEST_CHECK(( base + 1U ) == button_cfg_stats_get_store_cnt());
+
+    // More events are not retried before flush period
+    for ( uint32_t i = 0U; i < ( 2U * BUTTON_CFG_STATS_FLUSH_EVENTS ); i++ )
+    {
+        test_press( eBUTTON_TEST_0, 10U, 10U );
+    }
+
+    // Store attempt took place within last press
+    test_run( period - ( 2U * BUTTON_CFG_STATS_FLUSH_EVENTS * 20U ) - 40U );
+    TEST_CHECK(( base + 1U ) == button_cfg_stats_get_store_cnt());
+
+    // Retry after flush period
+    test_run( 40U );
+    TEST_CHECK(( base + 2U ) == button_cfg_stats_get_store_cnt());
+
+    test_run( period - 40U );
+    TEST_CHECK(( base + 2U ) == button_cfg_stats_get_store_cnt());
+
+    // NVM recovered
+    button_cfg_stats_set_fail( false );
+
+    test_run( 40U );
+    TEST_CHECK(( base + 3U ) == button_cfg_stats_get_store_cnt());
+
+    // Nothing left to store
+    TEST_CHECK( eBUTTON_OK == button_deinit());
+    TEST_CHECK(( base + 3U ) == button_cfg_stats_get_store_cnt());
+
+    test_init();
+
+    TEST_CHECK(( 3U * BUTTON_CFG_STATS_FLUSH_EVENTS ) == test_get( eBUTTON_TEST_0 ).press_cnt );
+
+    TEST_CHECK( eBUTTON_OK == button_deinit());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Active time of long press is not limited
+*
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_hold(void)
+{
+    (void) remove( gp_file );
+
+    test_init();
+
+    // 1000 sec hold of both buttons
+    test_set( eBUTTON_TEST_0, true );
+    test_set( eBUTTON_TEST_1, true );
+    test_run( 1000U * TEST_TICK_PER_S );
+    test_set( eBUTTON_TEST_0, false );
+    test_set( eBUTTON_TEST_1, false );
+    test_run( TEST_TICK_PER_S );
+
+    TEST_CHECK( 1U == test_get( eBUTTON_TEST_0 ).press_cnt );
+    TEST_CHECK(( test_get( eBUTTON_TEST_0 ).active_s >= 999U ) && ( test_get( eBUTTON_TEST_0 ).active_s <= 1000U ));
+    TEST_CHECK( 1U == test_get( eBUTTON_TEST_1 ).press_cnt );
+    TEST_CHECK(( test_get( eBUTTON_TEST_1 ).active_s >= 999U ) && ( test_get( eBUTTON_TEST_1 ).active_s <= 1000U ));
+
+    TEST_CHECK( eBUTTON_OK == button_deinit());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Active time of held button is stored before release
+*
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_held(void)
+{
+    const uint32_t  hold_s  = ( 10U * (uint32_t) BUTTON_CFG_STATS_FLUSH_PERIOD_S );
+    uint32_t        base    = 0U;
+
+    (void) remove( gp_file );
+
+    test_init();
+
+    base = button_cfg_stats_get_store_cnt();
+
+    test_set( eBUTTON_TEST_0, true );
+    test_run( hold_s * TEST_TICK_PER_S );
+
+    // Accounted while held & stored each flush period
+    TEST_CHECK( test_get( eBUTTON_TEST_0 ).active_s >= ( hold_s - 2U ));
+    TEST_CHECK(( base + 9U ) <= button_cfg_stats_get_store_cnt());
+
+    // Power loss: store at de-initialization is lost
+    button_cfg_stats_set_fail( true );
+    (void) button_deinit();
+    button_cfg_stats_set_fail( false );
+
+    test_init();
+
+    TEST_CHECK( 1U == test_get( eBUTTON_TEST_0 ).press_cnt );
+    TEST_CHECK( test_get( eBUTTON_TEST_0 ).active_s >= ( hold_s - (uint32_t) BUTTON_CFG_STATS_FLUSH_PERIOD_S - 2U ));
+
+    test_set( eBUTTON_TEST_0, false );
+    TEST_CHECK( eBUTTON_OK == button_deinit());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Running press is stored at de-initialization
+*
+* @note     Press is shorter than timing sweep over all buttons, thus its
+*           active time is accounted only at de-initialization.
+*
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_deinit(void)
+{
+    const uint32_t hold_s = 3U;
+
+    (void) remove( gp_file );
+
+    test_init();
+
+    test_set( eBUTTON_TEST_0, true );
+    test_run( hold_s * TEST_TICK_PER_S );
+
+    TEST_CHECK( eBUTTON_OK == button_deinit());
+
+    test_init();
+
+    // Press debounce time is not active time
+    TEST_CHECK( 1U == test_get( eBUTTON_TEST_0 ).press_cnt );
+    TEST_CHECK(( hold_s - 1U ) == test_get( eBUTTON_TEST_0 ).active_s );
+
+    TEST_CHECK( eBUTTON_OK == button_deinit());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Statistics test entry
+*
+* @param[in]    argc    - Number of arguments
+* @param[in]    argv    - Optional statistics file
+* @return       0 if all checks passed
+*/
+////////////////////////////////////////////////////////////////////////////////
+int main(int argc, char * argv[])
+{
+    if ( argc > 1 )
+    {
+        gp_file = argv[1];
+    }
+
+    button_cfg_stats_set_file( gp_file );
+
+    test_persist();
+    test_corrupt();
+    test_fail();
+    test_hold();
+    test_held();
+    test_deinit();
+
+    (void) remove( gp_file );
+
+    printf( "Statistics test: %s\n", ( true == gb_is_ok ) ? "passed" : "FAILED" );
+
+    return ( true == gb_is_ok ) ? 0 : 1;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
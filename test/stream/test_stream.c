@@ -0,0 +1,441 @@
+// Copyright (c) 2023 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @file     test_stream.c
+* @brief    Synthetic stream test of streaming ingest
+* @author   Ziga Miklosic
+* @email    ziga.miklosic@gmail.com
+* @date     18.10.2026
+* @version  V1.3.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @addtogroup BUTTON_TEST
+* @{ <!-- BEGIN GROUP -->
+*
+*   Random synthetic port stream (bouncing edges, glitches shorter than
+*   debounce time, noise on unused bits) is passed to "button_stream_ingest()"
+*   in random sized batches. Each port bit is debounced by simple per-sample
+*   model as well. After each batch state, sample of last edge and sequence
+*   of raised callbacks are compared against the model.
+*
+*   Usage: test_stream [number of seeds] [number of batches]
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "button/src/button.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *     Default number of seeds and batches per seed
+ */
+#define TEST_SEED_NUM                       ( 20U )
+#define TEST_BATCH_NUM                      ( 5000U )
+
+/**
+ *     Maximum batch size
+ */
+#define TEST_BATCH_MAX                      ( 64U )
+
+/**
+ *     Maximum number of callbacks within single batch
+ */
+#define TEST_EVENT_MAX                      ( TEST_BATCH_MAX * eBUTTON_NUM_OF )
+
+/**
+ *     Raised callback
+ */
+typedef struct
+{
+    button_num_t    num;        /**<Button */
+    bool            pressed;    /**<Pressed (true) or released (false) callback */
+} test_event_t;
+
+/**
+ *     Model of single stream input
+ */
+typedef struct
+{
+    button_num_t    num;        /**<Button */
+    uint32_t        bit;        /**<Port bit */
+    bool            inv;        /**<Active low */
+    bool            level;      /**<Generated (noise free) level */
+    uint32_t        burst;      /**<Number of remaining bouncing samples */
+    bool            known;      /**<First sample taken */
+    bool            deb;        /**<Debounced level */
+    uint32_t        cnt;        /**<Debounce counter */
+    uint32_t        edge;       /**<Sample of last edge */
+} test_input_t;
+
+/**
+ *     Callback trampolines of single button
+ */
+#define TEST_CB_DEF( num )                                                          \
+    static void test_pressed_##num(void)    { test_event_log( num, true ); }        \
+    static void test_released_##num(void)   { test_event_log( num, false ); }
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *     Raised callbacks of module and model
+ */
+static test_event_t g_event[TEST_EVENT_MAX] = { 0 };
+static uint32_t     g_event_num = 0U;
+static test_event_t g_model_event[TEST_EVENT_MAX] = { 0 };
+static uint32_t     g_model_event_num = 0U;
+
+/**
+ *     Stream inputs model
+ */
+static test_input_t g_input[] =
+{
+    { .num = eBUTTON_TEST_0 },
+    { .num = eBUTTON_TEST_1 },
+    { .num = eBUTTON_TEST_2 },
+    { .num = eBUTTON_TEST_3 },
+};
+
+#define TEST_INPUT_NUM                      ( sizeof( g_input ) / sizeof( g_input[0] ))
+
+/**
+ *     Pseudo random generator state
+ */
+static uint32_t g_rand = 1U;
+
+////////////////////////////////////////////////////////////////////////////////
+// Function Prototypes
+////////////////////////////////////////////////////////////////////////////////
+static void     test_event_log  (const button_num_t num, const bool pressed);
+static uint32_t test_rand       (const uint32_t range);
+static void     test_model      (const uint32_t smp, const uint32_t idx);
+static bool     test_compare    (const uint32_t seed, const uint32_t batch);
+static bool     test_seed       (const uint32_t seed, const uint32_t batch_num);
+
+////////////////////////////////////////////////////////////////////////////////
+// Callbacks
+////////////////////////////////////////////////////////////////////////////////
+TEST_CB_DEF( 0 ) TEST_CB_DEF( 1 ) TEST_CB_DEF( 2 ) TEST_CB_DEF( 3 )
+
+static const pf_button_callback g_pressed[]     = { test_pressed_0, test_pressed_1, test_pressed_2, test_pressed_3 };
+static const pf_button_callback g_released[]    = { test_released_0, test_released_1, test_released_2, test_released_3 };
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Log raised callback
+*
+* @param[in]    num     - Button
+* @param[in]    pressed - Pressed or released callback
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_event_log(const button_num_t num, const bool pressed)
+{
+    if ( g_event_num < TEST_EVENT_MAX )
+    {
+        g_event[g_event_num].num        = num;
+        g_event[g_event_num].pressed    = pressed;
+    }
+
+    // Overflow is reported as mismatch of number of events
+    g_event_num++;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get pseudo random number
+*
+* @param[in]    range   - Range of number
+* @return       rand    - Random number from 0 to range-1
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t test_rand(const uint32_t range)
+{
+    g_rand ^= ( g_rand << 13U );
+    g_rand ^= ( g_rand >> 17U );
+    g_rand ^= ( g_rand << 5U );
+
+    return ( g_rand % range );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Debounce single sample with per-input model
+*
+* @note     Edge is taken when input differs from debounced level for
+*           BUTTON_CFG_STREAM_DEB_NUM consecutive samples. First sample is
+*           taken as is.
+*
+* @param[in]    smp     - Raw port sample
+* @param[in]    idx     - Sample index from initialization
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_model(const uint32_t smp, const uint32_t idx)
+{
+    for ( uint32_t i = 0U; i < TEST_INPUT_NUM; i++ )
+    {
+        test_input_t * const p_in   = &g_input[i];
+        const bool           x      = (( 0U != ( smp & ( 1U << p_in->bit ))) != p_in->inv );
+
+        if ( false == p_in->known )
+        {
+            p_in->known = true;
+            p_in->deb   = x;
+            p_in->cnt   = 0U;
+            p_in->edge  = idx;
+        }
+        else if ( x != p_in->deb )
+        {
+            p_in->cnt++;
+
+            if ( p_in->cnt >= BUTTON_CFG_STREAM_DEB_NUM )
+            {
+                p_in->deb   = x;
+                p_in->cnt   = 0U;
+                p_in->edge  = idx;
+
+                if ( g_model_event_num < TEST_EVENT_MAX )
+                {
+                    g_model_event[g_model_event_num].num        = p_in->num;
+                    g_model_event[g_model_event_num].pressed    = x;
+                }
+
+                g_model_event_num++;
+            }
+        }
+        else
+        {
+            p_in->cnt = 0U;
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Compare module against model after batch
+*
+* @param[in]    seed    - Seed
+* @param[in]    batch   - Batch number
+* @return       true if both are equal
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool test_compare(const uint32_t seed, const uint32_t batch)
+{
+    bool is_equal = true;
+
+    if ( g_event_num != g_model_event_num )
+    {
+        printf( "seed %u, batch %u: %u callbacks, model %u\n", seed, batch, g_event_num, g_model_event_num );
+        is_equal = false;
+    }
+    else
+    {
+        for ( uint32_t e = 0U; ( e < g_event_num ) && ( e < TEST_EVENT_MAX ); e++ )
+        {
+            if  (   ( g_event[e].num     != g_model_event[e].num )
+                ||  ( g_event[e].pressed != g_model_event[e].pressed ))
+            {
+                printf( "seed %u, batch %u: callback %u of button %d (pressed %d), model button %d (pressed %d)\n",
+                        seed, batch, e, g_event[e].num, g_event[e].pressed, g_model_event[e].num, g_model_event[e].pressed );
+                is_equal = false;
+            }
+        }
+    }
+
+    for ( uint32_t i = 0U; i < TEST_INPUT_NUM; i++ )
+    {
+        const test_input_t * const  p_in    = &g_input[i];
+        button_state_t              state   = eBUTTON_UNKNOWN;
+        uint32_t                    edge    = 0U;
+
+        (void) button_get_state( p_in->num, &state );
+        (void) button_stream_get_edge( p_in->num, &edge );
+
+        if ( true == p_in->known )
+        {
+            if  (   ( state != (( true == p_in->deb ) ? eBUTTON_ON : eBUTTON_OFF ))
+                ||  ( edge != p_in->edge ))
+            {
+                printf( "seed %u, batch %u, button %d: state %d, edge %u; model state %d, edge %u\n",
+                        seed, batch, p_in->num, state, edge, p_in->deb, p_in->edge );
+                is_equal = false;
+            }
+        }
+    }
+
+    return is_equal;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Run stream test with single seed
+*
+* @param[in]    seed        - Seed
+* @param[in]    batch_num   - Number of batches
+* @return       true if module matches model
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool test_seed(const uint32_t seed, const uint32_t batch_num)
+{
+    const button_cfg_t * const  p_cfg   = button_cfg_get_table();
+    uint32_t                    buf[TEST_BATCH_MAX];
+    uint32_t                    idx     = 0U;
+    uint32_t                    edge    = 0U;
+    bool                        is_ok   = true;
+
+    g_rand = ( seed * 2654435761U ) | 1U;
+
+    for ( uint32_t i = 0U; i < TEST_INPUT_NUM; i++ )
+    {
+        g_input[i].bit      = p_cfg[ g_input[i].num ].stream_bit;
+        g_input[i].inv      = ( eBUTTON_POL_ACTIVE_LOW == p_cfg[ g_input[i].num ].polarity );
+        g_input[i].level    = false;
+        g_input[i].burst    = 0U;
+        g_input[i].known    = false;
+    }
+
+    if ( eBUTTON_OK != button_init())
+    {
+        printf( "seed %u: init failed\n", seed );
+        is_ok = false;
+    }
+
+    for ( uint32_t i = 0U; i < TEST_INPUT_NUM; i++ )
+    {
+        (void) button_register_callback( g_input[i].num, g_pressed[i], g_released[i] );
+    }
+
+    // Stream edge is available only for stream inputs
+    if ( eBUTTON_ERROR != button_stream_get_edge( eBUTTON_TEST_4, &edge ))
+    {
+        printf( "seed %u: stream edge of GPIO input\n", seed );
+        is_ok = false;
+    }
+
+    for ( uint32_t batch = 0U; ( batch < batch_num ) && ( true == is_ok ); batch++ )
+    {
+        const uint32_t num_of = test_rand( TEST_BATCH_MAX + 1U );
+
+        // Generate batch: noise on all bits, inputs overwritten below
+        for ( uint32_t s = 0U; s < num_of; s++ )
+        {
+            uint32_t smp = ( test_rand( 0xFFFFU ) << 16U ) ^ test_rand( 0xFFFFU );
+
+            for ( uint32_t i = 0U; i < TEST_INPUT_NUM; i++ )
+            {
+                test_input_t * const p_in = &g_input[i];
+                bool                 x    = p_in->level;
+
+                // New level with bouncing edge
+                if ( 0U == test_rand( 200U ))
+                {
+                    p_in->level = !p_in->level;
+                    p_in->burst = test_rand( 4U * BUTTON_CFG_STREAM_DEB_NUM );
+                }
+
+                // Bouncing or short glitch
+                if ( p_in->burst > 0U )
+                {
+                    p_in->burst--;
+                    x = ( 0U != test_rand( 2U ));
+                }
+                else if ( 0U == test_rand( 100U ))
+                {
+                    p_in->burst = test_rand( BUTTON_CFG_STREAM_DEB_NUM );
+                    x = !p_in->level;
+                }
+                else
+                {
+                    x = p_in->level;
+                }
+
+                smp = ( smp & ~( 1U << p_in->bit )) | ((uint32_t)( x != p_in->inv ) << p_in->bit );
+            }
+
+            buf[s] = smp;
+        }
+
+        g_event_num         = 0U;
+        g_model_event_num   = 0U;
+
+        for ( uint32_t s = 0U; s < num_of; s++ )
+        {
+            test_model( buf[s], idx );
+            idx++;
+        }
+
+        if ( eBUTTON_OK != button_stream_ingest( buf, num_of ))
+        {
+            printf( "seed %u, batch %u: ingest failed\n", seed, batch );
+            is_ok = false;
+        }
+
+        // Handler call between batches
+        if ( 0U != test_rand( 4U ))
+        {
+            (void) button_hndl();
+        }
+
+        if ( true == is_ok )
+        {
+            is_ok = test_compare( seed, batch );
+        }
+    }
+
+    (void) button_deinit();
+
+    return is_ok;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Stream test entry
+*
+* @param[in]    argc    - Number of arguments
+* @param[in]    argv    - Optional number of seeds and number of batches
+* @return       0 if all seeds passed
+*/
+////////////////////////////////////////////////////////////////////////////////
+int main(int argc, char * argv[])
+{
+    const uint32_t  seed_num    = ( argc > 1 ) ? (uint32_t) strtoul( argv[1], NULL, 0 ) : TEST_SEED_NUM;
+    const uint32_t  batch_num   = ( argc > 2 ) ? (uint32_t) strtoul( argv[2], NULL, 0 ) : TEST_BATCH_NUM;
+    uint32_t        fail_num    = 0U;
+
+    for ( uint32_t seed = 1U; seed <= seed_num; seed++ )
+    {
+        if ( false == test_seed( seed, batch_num ))
+        {
+            fail_num++;
+        }
+    }
+
+    printf( "Stream test: %u of %u seeds (%u batches) passed\n", ( seed_num - fail_num ), seed_num, batch_num );
+
+    return ( 0U == fail_num ) ? 0 : 1;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
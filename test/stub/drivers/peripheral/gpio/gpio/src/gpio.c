@@ -0,0 +1,179 @@
+// Copyright (c) 2023 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @file     gpio.c
+* @brief    GPIO stub for host testing of Button module
+* @author   Ziga Miklosic
+* @email    ziga.miklosic@gmail.com
+* @date     18.10.2026
+* @version  V0.1.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @addtogroup GPIO_STUB
+* @{ <!-- BEGIN GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stddef.h>
+
+#include "gpio.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *     Pin levels
+ */
+static gpio_state_t g_pin[eGPIO_NUM_OF] = { eGPIO_LOW };
+
+/**
+ *     Pin read patterns. Bit "n" is level of "n"-th read in cycle of
+ *     "len" reads, no pattern when length is zero.
+ */
+static uint32_t g_pattern[eGPIO_NUM_OF]     = { 0 };
+static uint8_t  g_pattern_len[eGPIO_NUM_OF] = { 0 };
+static uint8_t  g_pattern_pos[eGPIO_NUM_OF] = { 0 };
+
+/**
+ *     Number of pin reads
+ */
+static uint32_t g_read_cnt[eGPIO_NUM_OF] = { 0 };
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get GPIO initialization flag
+*
+* @param[out]   p_is_init   - Initialization flag, always true
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+gpio_status_t gpio_is_init(bool * const p_is_init)
+{
+    gpio_status_t status = eGPIO_OK;
+
+    if ( NULL != p_is_init )
+    {
+        *p_is_init = true;
+    }
+    else
+    {
+        status = eGPIO_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get GPIO pin level
+*
+* @param[in]    pin     - GPIO pin
+* @param[out]   p_state - Pin level
+* @return       status  - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+gpio_status_t gpio_get(const gpio_pin_t pin, gpio_state_t * const p_state)
+{
+    gpio_status_t status = eGPIO_OK;
+
+    if  (   ( pin < eGPIO_NUM_OF )
+        &&  ( NULL != p_state ))
+    {
+        g_read_cnt[pin]++;
+
+        // Next read of pattern
+        if ( g_pattern_len[pin] > 0U )
+        {
+            g_pin[pin] = ( 0U != ( g_pattern[pin] & ( 1UL << g_pattern_pos[pin] ))) ? eGPIO_HIGH : eGPIO_LOW;
+            g_pattern_pos[pin] = (uint8_t)(( g_pattern_pos[pin] + 1U ) % g_pattern_len[pin] );
+        }
+
+        *p_state = g_pin[pin];
+    }
+    else
+    {
+        status = eGPIO_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Set GPIO pin level (stub control)
+*
+* @param[in]    pin     - GPIO pin
+* @param[in]    state   - Pin level
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void gpio_stub_set(const gpio_pin_t pin, const gpio_state_t state)
+{
+    if ( pin < eGPIO_NUM_OF )
+    {
+        g_pin[pin]          = state;
+        g_pattern_len[pin]  = 0U;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Set GPIO pin read pattern (stub control)
+*
+* @note     Cycle starts with bit 0 at next read. Pattern is cleared by
+*           "gpio_stub_set()".
+*
+* @param[in]    pin     - GPIO pin
+* @param[in]    pattern - Levels of reads in cycle, bit set when high
+* @param[in]    len     - Number of reads in cycle (1-32)
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+void gpio_stub_set_pattern(const gpio_pin_t pin, const uint32_t pattern, const uint8_t len)
+{
+    if  (   ( pin < eGPIO_NUM_OF )
+        &&  ( len >= 1U )
+        &&  ( len <= 32U ))
+    {
+        g_pattern[pin]      = pattern;
+        g_pattern_len[pin]  = len;
+        g_pattern_pos[pin]  = 0U;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get number of GPIO pin reads (stub control)
+*
+* @param[in]    pin     - GPIO pin
+* @return       cnt     - Number of reads since start
+*/
+////////////////////////////////////////////////////////////////////////////////
+uint32_t gpio_stub_get_read_cnt(const gpio_pin_t pin)
+{
+    uint32_t cnt = 0U;
+
+    if ( pin < eGPIO_NUM_OF )
+    {
+        cnt = g_read_cnt[pin];
+    }
+
+    return cnt;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,104 @@
+// Copyright (c) 2023 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @file     gpio.h
+* @brief    GPIO stub for host testing of Button module
+* @author   Ziga Miklosic
+* @email    ziga.miklosic@gmail.com
+* @date     18.10.2026
+* @version  V0.1.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @addtogroup GPIO_STUB
+* @{ <!-- BEGIN GROUP -->
+*
+*   Implements only part of GPIO API used by Button module. Pin levels are
+*   set by test via "gpio_stub_set()" or, for noisy pin, cycled through
+*   read pattern set via "gpio_stub_set_pattern()".
+*/
+////////////////////////////////////////////////////////////////////////////////
+#ifndef __GPIO_H_
+#define __GPIO_H_
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+#include <stdbool.h>
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *     Module version (compatible GPIO module API)
+ */
+#define GPIO_VER_MAJOR          ( 0 )
+#define GPIO_VER_MINOR          ( 1 )
+#define GPIO_VER_DEVELOP        ( 0 )
+
+/**
+ *     GPIO status
+ */
+typedef enum
+{
+    eGPIO_OK    = 0x00U,    /**<Normal operation */
+    eGPIO_ERROR = 0x01U,    /**<General error code */
+} gpio_status_t;
+
+/**
+ *     GPIO state
+ */
+typedef enum
+{
+    eGPIO_LOW = 0,  /**<Low level */
+    eGPIO_HIGH,     /**<High level */
+    eGPIO_UKNOWN,   /**<Unknown level */
+} gpio_state_t;
+
+/**
+ *     GPIO pins
+ */
+typedef enum
+{
+    eGPIO_PIN_0 = 0,
+    eGPIO_PIN_1,
+    eGPIO_PIN_2,
+    eGPIO_PIN_3,
+    eGPIO_PIN_4,
+    eGPIO_PIN_5,
+    eGPIO_PIN_6,
+    eGPIO_PIN_7,
+    eGPIO_PIN_8,
+    eGPIO_PIN_9,
+    eGPIO_PIN_10,
+    eGPIO_PIN_11,
+    eGPIO_PIN_12,
+    eGPIO_PIN_13,
+    eGPIO_PIN_14,
+    eGPIO_PIN_15,
+
+    eGPIO_NUM_OF
+} gpio_pin_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+gpio_status_t gpio_is_init          (bool * const p_is_init);
+gpio_status_t gpio_get              (const gpio_pin_t pin, gpio_state_t * const p_state);
+
+// Stub control
+void          gpio_stub_set         (const gpio_pin_t pin, const gpio_state_t state);
+void          gpio_stub_set_pattern (const gpio_pin_t pin, const uint32_t pattern, const uint8_t len);
+uint32_t      gpio_stub_get_read_cnt(const gpio_pin_t pin);
+
+#endif // __GPIO_H_
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
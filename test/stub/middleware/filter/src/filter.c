@@ -0,0 +1,272 @@
+// Copyright (c) 2023 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @file     filter.c
+* @brief    Filter stub for host testing of Button module
+* @author   Ziga Miklosic
+* @email    ziga.miklosic@gmail.com
+* @date     18.10.2026
+* @version  V2.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @addtogroup FILTER_STUB
+* @{ <!-- BEGIN GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdlib.h>
+
+#include "filter.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *     Boolean filter data
+ */
+typedef struct filter_bool_s
+{
+    float32_t   y;      /**<RC filter output */
+    float32_t   a;      /**<RC filter coefficient */
+    float32_t   fs;     /**<Sample frequency */
+    float32_t   lvl;    /**<Comparator level */
+    bool        out;    /**<Comparator output */
+} filter_bool_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *     Number of allocated filters
+ */
+static uint32_t g_filter_num = 0U;
+
+/**
+ *     Number of filter updates
+ */
+static uint32_t g_filter_hndl_cnt = 0U;
+
+////////////////////////////////////////////////////////////////////////////////
+// Function Prototypes
+////////////////////////////////////////////////////////////////////////////////
+static float32_t filter_rc_coef(const float32_t fc, const float32_t fs);
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Calculate RC filter coefficient
+*
+* @param[in]    fc  - Cutoff frequency
+* @param[in]    fs  - Sample frequency
+* @return       a   - Filter coefficient
+*/
+////////////////////////////////////////////////////////////////////////////////
+static float32_t filter_rc_coef(const float32_t fc, const float32_t fs)
+{
+    const float32_t dt  = ( 1.0f / fs );
+    const float32_t tau = ( 1.0f / ( 6.2831853f * fc ));
+
+    return ( dt / ( tau + dt ));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Initialize boolean filter
+*
+* @param[out]   p_filter_inst   - Filter instance
+* @param[in]    fc              - Cutoff frequency
+* @param[in]    fs              - Sample frequency
+* @param[in]    comp_lvl        - Comparator level
+* @return       status          - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_bool_init(p_filter_bool_t * p_filter_inst, const float32_t fc, const float32_t fs, const float32_t comp_lvl)
+{
+    filter_status_t status = eFILTER_OK;
+
+    if ( NULL != p_filter_inst )
+    {
+        *p_filter_inst = calloc( 1U, sizeof( filter_bool_t ));
+
+        if ( NULL != *p_filter_inst )
+        {
+            (*p_filter_inst)->a     = filter_rc_coef( fc, fs );
+            (*p_filter_inst)->fs    = fs;
+            (*p_filter_inst)->lvl   = comp_lvl;
+            g_filter_num++;
+        }
+        else
+        {
+            status = eFILTER_ERROR;
+        }
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       De-initialize boolean filter
+*
+* @param[in]    p_filter_inst   - Filter instance
+* @return       status          - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_bool_deinit(p_filter_bool_t * p_filter_inst)
+{
+    filter_status_t status = eFILTER_OK;
+
+    if  (   ( NULL != p_filter_inst )
+        &&  ( NULL != *p_filter_inst ))
+    {
+        free( *p_filter_inst );
+        *p_filter_inst = NULL;
+        g_filter_num--;
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Update boolean filter
+*
+* @param[in]    filter_inst - Filter instance
+* @param[in]    in          - Input
+* @param[out]   p_out       - Output
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_bool_hndl(p_filter_bool_t filter_inst, const bool in, bool * const p_out)
+{
+    filter_status_t status = eFILTER_OK;
+
+    if  (   ( NULL != filter_inst )
+        &&  ( NULL != p_out ))
+    {
+        g_filter_hndl_cnt++;
+
+        filter_inst->y += ( filter_inst->a * (( true == in ? 1.0f : 0.0f ) - filter_inst->y ));
+
+        // Comparator with hysteresis
+        if ( filter_inst->y > ( 1.0f - filter_inst->lvl ))
+        {
+            filter_inst->out = true;
+        }
+        else if ( filter_inst->y < filter_inst->lvl )
+        {
+            filter_inst->out = false;
+        }
+        else
+        {
+            // No actions...
+        }
+
+        *p_out = filter_inst->out;
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Reset boolean filter
+*
+* @param[in]    filter_inst - Filter instance
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_bool_reset(p_filter_bool_t filter_inst)
+{
+    filter_status_t status = eFILTER_OK;
+
+    if ( NULL != filter_inst )
+    {
+        filter_inst->y      = 0.0f;
+        filter_inst->out    = false;
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Change cutoff frequency of boolean filter
+*
+* @param[in]    filter_inst - Filter instance
+* @param[in]    fc          - Cutoff frequency
+* @return       status      - Status of operation
+*/
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_bool_fc_set(p_filter_bool_t filter_inst, const float32_t fc)
+{
+    filter_status_t status = eFILTER_OK;
+
+    if ( NULL != filter_inst )
+    {
+        filter_inst->a = filter_rc_coef( fc, filter_inst->fs );
+    }
+    else
+    {
+        status = eFILTER_ERROR;
+    }
+
+    return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get number of allocated filters (stub control)
+*
+* @return       num - Number of allocated filters
+*/
+////////////////////////////////////////////////////////////////////////////////
+uint32_t filter_stub_get_num(void)
+{
+    return g_filter_num;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get number of filter updates (stub control)
+*
+* @return       cnt - Number of "filter_bool_hndl()" calls
+*/
+////////////////////////////////////////////////////////////////////////////////
+uint32_t filter_stub_get_hndl_cnt(void)
+{
+    return g_filter_hndl_cnt;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,80 @@
+// Copyright (c) 2023 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @file     filter.h
+* @brief    Filter stub for host testing of Button module
+* @author   Ziga Miklosic
+* @email    ziga.miklosic@gmail.com
+* @date     18.10.2026
+* @version  V2.0.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @addtogroup FILTER_STUB
+* @{ <!-- BEGIN GROUP -->
+*
+*   Implements only boolean filter (RC 1st order IIR with comparator) of
+*   Filter module API.
+*/
+////////////////////////////////////////////////////////////////////////////////
+#ifndef __FILTER_H_
+#define __FILTER_H_
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+#include <stdbool.h>
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *     Module version (compatible Filter module API)
+ */
+#define FILTER_VER_MAJOR        ( 2 )
+#define FILTER_VER_MINOR        ( 0 )
+#define FILTER_VER_DEVELOP      ( 0 )
+
+/**
+ *  32-bit floating data type definition
+ */
+typedef float float32_t;
+
+/**
+ *     Filter status
+ */
+typedef enum
+{
+    eFILTER_OK      = 0x00U,    /**<Normal operation */
+    eFILTER_ERROR   = 0x01U,    /**<General error code */
+} filter_status_t;
+
+/**
+ *     Boolean filter instance
+ */
+typedef struct filter_bool_s * p_filter_bool_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+filter_status_t filter_bool_init    (p_filter_bool_t * p_filter_inst, const float32_t fc, const float32_t fs, const float32_t comp_lvl);
+filter_status_t filter_bool_deinit  (p_filter_bool_t * p_filter_inst);
+filter_status_t filter_bool_hndl    (p_filter_bool_t filter_inst, const bool in, bool * const p_out);
+filter_status_t filter_bool_reset   (p_filter_bool_t filter_inst);
+filter_status_t filter_bool_fc_set  (p_filter_bool_t filter_inst, const float32_t fc);
+
+// Stub control
+uint32_t        filter_stub_get_num         (void);
+uint32_t        filter_stub_get_hndl_cnt    (void);
+
+#endif // __FILTER_H_
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
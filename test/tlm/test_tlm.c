@@ -0,0 +1,282 @@
+// Copyright (c) 2023 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @file     test_tlm.c
+* @brief    Telemetry frame encode & decode test
+* @author   Ziga Miklosic
+* @email    ziga.miklosic@gmail.com
+* @date     18.10.2026
+* @version  V1.3.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @addtogroup BUTTON_TEST
+* @{ <!-- BEGIN GROUP -->
+*
+*   Frame with known records is encoded and decoded back. Then frames with
+*   malformed last record (invalid event, truncated value) and valid
+*   checksum are decoded. Malformed frame shall be rejected without any
+*   record reported.
+*
+*   Usage: test_tlm
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "button/src/button.h"
+#include "button/src/button_tlm.h"
+#include "button/src/button_tlm_priv.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *     Size of frame buffer
+ *
+ *     Unit: byte
+ */
+#define TEST_BUF_SIZE                       ( 128U )
+
+/**
+ *     Maximum number of decoded records
+ */
+#define TEST_REC_MAX                        ( 16U )
+
+/**
+ *     Check condition and report failure
+ */
+#define TEST_CHECK( cond )                                                          \
+    do                                                                              \
+    {                                                                               \
+        if ( !( cond ))                                                             \
+        {                                                                           \
+            printf( "%s:%d: check failed: %s\n", __func__, __LINE__, #cond );       \
+            gb_is_ok = false;                                                       \
+        }                                                                           \
+    } while ( 0 )
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *     Test result
+ */
+static bool gb_is_ok = true;
+
+/**
+ *     Encoded records
+ */
+static const button_tlm_rec_t g_rec[] =
+{
+    { .evt = eBUTTON_TLM_EVT_PRESS,     .num = 0U,      .tick = 10U,    .data = 0U },
+    { .evt = eBUTTON_TLM_EVT_RELEASE,   .num = 0U,      .tick = 25U,    .data = 0U },
+    { .evt = eBUTTON_TLM_EVT_PRESS,     .num = 100U,    .tick = 300U,   .data = 0U },
+    { .evt = eBUTTON_TLM_EVT_GESTURE,   .num = 1U,      .tick = 1000U,  .data = BUTTON_TLM_GESTURE_DATA( eBUTTON_TLM_GESTURE_REPEAT, 3U ) },
+    { .evt = eBUTTON_TLM_EVT_PRESS,     .num = 1U,      .tick = 1001U,  .data = 0U },
+};
+
+#define TEST_REC_NUM                        ( sizeof( g_rec ) / sizeof( g_rec[0] ))
+
+/**
+ *     Decoded records
+ */
+static button_tlm_rec_t g_dec[TEST_REC_MAX] = { 0 };
+static uint32_t         g_dec_num = 0U;
+
+////////////////////////////////////////////////////////////////////////////////
+// Function Prototypes
+////////////////////////////////////////////////////////////////////////////////
+static void     test_rec        (const button_tlm_rec_t * const p_rec);
+static uint8_t  test_crc        (const uint8_t * const p_data, const uint32_t size);
+static uint32_t test_encode     (uint8_t * const p_frame);
+static void     test_decode     (void);
+static void     test_malformed  (void);
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Log decoded record
+*
+* @param[in]    p_rec   - Decoded record
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_rec(const button_tlm_rec_t * const p_rec)
+{
+    if ( g_dec_num < TEST_REC_MAX )
+    {
+        g_dec[g_dec_num] = *p_rec;
+    }
+
+    g_dec_num++;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Calculate frame checksum (CRC-8, polynomial 0x07)
+*
+* @param[in]    p_data  - Pointer to data
+* @param[in]    size    - Size of data
+* @return       crc     - Checksum
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint8_t test_crc(const uint8_t * const p_data, const uint32_t size)
+{
+    uint8_t crc = 0U;
+
+    for ( uint32_t i = 0U; i < size; i++ )
+    {
+        crc ^= p_data[i];
+
+        for ( uint8_t b = 0U; b < 8U; b++ )
+        {
+            crc = ( 0U != ( crc & 0x80U )) ? (uint8_t)(( crc << 1U ) ^ 0x07U ) : (uint8_t)( crc << 1U );
+        }
+    }
+
+    return crc;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Encode test records into frame
+*
+* @param[out]   p_frame - Frame of TEST_BUF_SIZE bytes
+* @return       size    - Size of frame
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t test_encode(uint8_t * const p_frame)
+{
+    static uint8_t  buf[TEST_BUF_SIZE];
+    const uint8_t * p_out   = NULL;
+    uint32_t        size    = 0U;
+
+    TEST_CHECK( eBUTTON_OK == button_tlm_set_buf( buf, sizeof( buf )));
+
+    for ( uint32_t r = 0U; r < TEST_REC_NUM; r++ )
+    {
+        button_tlm_put( g_rec[r].evt, g_rec[r].num, g_rec[r].tick, g_rec[r].data );
+    }
+
+    TEST_CHECK( eBUTTON_OK == button_tlm_flush( &p_out, &size ));
+    TEST_CHECK(( size > 0U ) && ( size <= TEST_BUF_SIZE ));
+
+    if ( size <= TEST_BUF_SIZE )
+    {
+        memcpy( p_frame, p_out, size );
+    }
+
+    return size;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Encoded records are decoded back
+*
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_decode(void)
+{
+    uint8_t         frame[TEST_BUF_SIZE];
+    const uint32_t  size = test_encode( frame );
+
+    g_dec_num = 0U;
+
+    TEST_CHECK( eBUTTON_OK == button_tlm_decode( frame, size, test_rec ));
+    TEST_CHECK( TEST_REC_NUM == g_dec_num );
+
+    for ( uint32_t r = 0U; ( r < TEST_REC_NUM ) && ( r < g_dec_num ); r++ )
+    {
+        TEST_CHECK( g_rec[r].evt  == g_dec[r].evt );
+        TEST_CHECK( g_rec[r].num  == g_dec[r].num );
+        TEST_CHECK( g_rec[r].tick == g_dec[r].tick );
+        TEST_CHECK( g_rec[r].data == g_dec[r].data );
+    }
+
+    // Checksum error
+    frame[ size / 2U ] ^= 0x10U;
+    g_dec_num = 0U;
+
+    TEST_CHECK( eBUTTON_ERROR == button_tlm_decode( frame, size, test_rec ));
+    TEST_CHECK( 0U == g_dec_num );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Malformed frame with valid checksum reports no records
+*
+* @note     Last record is press of button 1 with one byte tick delta, thus
+*           it takes last two bytes before checksum.
+*
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_malformed(void)
+{
+    uint8_t         frame[TEST_BUF_SIZE];
+    const uint32_t  size = test_encode( frame );
+
+    TEST_CHECK( size > 3U );
+
+    if ( size > 3U )
+    {
+        // Invalid event of last record
+        frame[ size - 3U ] |= 0xE0U;
+        frame[ size - 1U ] = test_crc( frame, ( size - 1U ));
+        g_dec_num = 0U;
+
+        TEST_CHECK( eBUTTON_ERROR == button_tlm_decode( frame, size, test_rec ));
+        TEST_CHECK( 0U == g_dec_num );
+    }
+
+    (void) test_encode( frame );
+
+    if ( size > 3U )
+    {
+        // Truncated tick delta of last record
+        frame[ size - 2U ] |= 0x80U;
+        frame[ size - 1U ] = test_crc( frame, ( size - 1U ));
+        g_dec_num = 0U;
+
+        TEST_CHECK( eBUTTON_ERROR == button_tlm_decode( frame, size, test_rec ));
+        TEST_CHECK( 0U == g_dec_num );
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Telemetry test entry
+*
+* @return       0 if all checks passed
+*/
+////////////////////////////////////////////////////////////////////////////////
+int main(void)
+{
+    test_decode();
+    test_malformed();
+
+    printf( "Telemetry test: %s\n", ( true == gb_is_ok ) ? "passed" : "FAILED" );
+
+    return ( true == gb_is_ok ) ? 0 : 1;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
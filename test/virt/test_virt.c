@@ -0,0 +1,271 @@
+// Copyright (c) 2023 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @file     test_virt.c
+* @brief    Virtual input test
+* @author   Ziga Miklosic
+* @email    ziga.miklosic@gmail.com
+* @date     18.10.2026
+* @version  V1.3.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @addtogroup BUTTON_TEST
+* @{ <!-- BEGIN GROUP -->
+*
+*   Virtual inputs in both bitmask words are written by single and multiple
+*   input writes, while GPIO pin of virtual buttons is held active. Writes
+*   shall affect only virtual buttons within write mask, ignore GPIO, be
+*   done within balanced critical section and be cleared by
+*   re-initialization.
+*
+*   Usage: test_virt
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "button/src/button.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *     Number of handler calls in one second
+ */
+#define TEST_TICK_PER_S                     ((uint32_t)( 1.0f / BUTTON_CFG_HNDL_PERIOD_S + 0.5f ))
+
+/**
+ *     Debounce time with margin
+ *
+ *     Unit: handler calls
+ */
+#define TEST_DEB_TICK                       ( 5U )
+
+/**
+ *     Button bitmask bit
+ */
+#define TEST_BIT( num )                     ((uint32_t)( 1UL << (((uint32_t)( num )) & 0x1FU )))
+
+/**
+ *     Check condition and report failure
+ */
+#define TEST_CHECK( cond )                                                          \
+    do                                                                              \
+    {                                                                               \
+        if ( !( cond ))                                                             \
+        {                                                                           \
+            printf( "%s:%d: check failed: %s\n", __func__, __LINE__, #cond );       \
+            gb_is_ok = false;                                                       \
+        }                                                                           \
+    } while ( 0 )
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ *     Test result
+ */
+static bool gb_is_ok = true;
+
+/**
+ *     Critical section nesting depth & number of entries
+ */
+int32_t     g_test_crit_depth   = 0;
+uint32_t    g_test_crit_cnt     = 0U;
+
+////////////////////////////////////////////////////////////////////////////////
+// Function Prototypes
+////////////////////////////////////////////////////////////////////////////////
+static void             test_run        (const uint32_t tick);
+static button_state_t   test_state      (const button_num_t num);
+static void             test_expect     (const bool on_0, const bool on_1, const bool on_32);
+static void             test_set        (void);
+static void             test_write      (void);
+static void             test_reinit     (void);
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Call button handler
+*
+* @param[in]    tick    - Number of handler calls
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_run(const uint32_t tick)
+{
+    for ( uint32_t i = 0U; i < tick; i++ )
+    {
+        (void) button_hndl();
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Get button state
+*
+* @param[in]    num     - Button
+* @return       state   - State of button
+*/
+////////////////////////////////////////////////////////////////////////////////
+static button_state_t test_state(const button_num_t num)
+{
+    button_state_t state = eBUTTON_UNKNOWN;
+
+    TEST_CHECK( eBUTTON_OK == button_get_state( num, &state ));
+
+    return state;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Debounce and check states of virtual buttons
+*
+* @note     GPIO button is always expected idle.
+*
+* @param[in]    on_0    - Button 0 expected pressed
+* @param[in]    on_1    - Button 1 expected pressed
+* @param[in]    on_32   - Button 32 expected pressed
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_expect(const bool on_0, const bool on_1, const bool on_32)
+{
+    test_run( TEST_DEB_TICK );
+
+    TEST_CHECK((( true == on_0 ) ? eBUTTON_ON : eBUTTON_OFF ) == test_state( eBUTTON_TEST_0 ));
+    TEST_CHECK((( true == on_1 ) ? eBUTTON_ON : eBUTTON_OFF ) == test_state( eBUTTON_TEST_1 ));
+    TEST_CHECK((( true == on_32 ) ? eBUTTON_ON : eBUTTON_OFF ) == test_state( eBUTTON_TEST_32 ));
+    TEST_CHECK( eBUTTON_OFF == test_state( eBUTTON_TEST_2 ));
+    TEST_CHECK( eBUTTON_OFF == test_state( eBUTTON_TEST_IDLE ));
+
+    // Critical section left after each write
+    TEST_CHECK( 0 == g_test_crit_depth );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Single virtual input write
+*
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_set(void)
+{
+    const uint32_t crit_cnt = g_test_crit_cnt;
+
+    // Active GPIO pin of virtual buttons is ignored
+    test_expect( false, false, false );
+
+    TEST_CHECK( eBUTTON_OK == button_virt_set( eBUTTON_TEST_0, true ));
+    test_expect( true, false, false );
+
+    TEST_CHECK( eBUTTON_OK == button_virt_set( eBUTTON_TEST_32, true ));
+    test_expect( true, false, true );
+
+    TEST_CHECK( eBUTTON_OK == button_virt_set( eBUTTON_TEST_0, false ));
+    TEST_CHECK( eBUTTON_OK == button_virt_set( eBUTTON_TEST_32, false ));
+    test_expect( false, false, false );
+
+    TEST_CHECK(( crit_cnt + 4U ) == g_test_crit_cnt );
+
+    // GPIO button rejected without entering critical section
+    TEST_CHECK( eBUTTON_ERROR == button_virt_set( eBUTTON_TEST_2, true ));
+    test_expect( false, false, false );
+
+    TEST_CHECK(( crit_cnt + 4U ) == g_test_crit_cnt );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Multiple virtual inputs write
+*
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_write(void)
+{
+    const uint32_t crit_cnt = g_test_crit_cnt;
+
+    // Bit of GPIO button is ignored
+    TEST_CHECK( eBUTTON_OK == button_virt_write( 0U, 0xFFFFFFFFU, ( TEST_BIT( eBUTTON_TEST_0 ) | TEST_BIT( eBUTTON_TEST_2 ))));
+    test_expect( true, false, false );
+
+    // Inputs outside of mask are kept
+    TEST_CHECK( eBUTTON_OK == button_virt_write( 0U, TEST_BIT( eBUTTON_TEST_1 ), 0xFFFFFFFFU ));
+    test_expect( true, true, false );
+
+    TEST_CHECK( eBUTTON_OK == button_virt_write( 1U, TEST_BIT( eBUTTON_TEST_32 ), TEST_BIT( eBUTTON_TEST_32 )));
+    test_expect( true, true, true );
+
+    TEST_CHECK( eBUTTON_OK == button_virt_write( 0U, TEST_BIT( eBUTTON_TEST_0 ), 0U ));
+    test_expect( false, true, true );
+
+    TEST_CHECK(( crit_cnt + 4U ) == g_test_crit_cnt );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Re-initialization releases virtual inputs
+*
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void test_reinit(void)
+{
+    // Buttons 1 & 32 left active
+    TEST_CHECK( eBUTTON_OK == button_deinit());
+    TEST_CHECK( eBUTTON_OK == button_init());
+    test_expect( false, false, false );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*       Virtual input test entry
+*
+* @return       0 if all checks passed
+*/
+////////////////////////////////////////////////////////////////////////////////
+int main(void)
+{
+    for ( button_num_t num = 0; num < eBUTTON_NUM_OF; num++ )
+    {
+        gpio_stub_set( button_cfg_get_table()[num].gpio_pin, eGPIO_LOW );
+    }
+
+    // GPIO pin of virtual buttons
+    gpio_stub_set( button_cfg_get_table()[eBUTTON_TEST_0].gpio_pin, eGPIO_HIGH );
+
+    TEST_CHECK( eBUTTON_OK == button_init());
+
+    test_run( TEST_TICK_PER_S );
+
+    test_set();
+    test_write();
+    test_reinit();
+
+    TEST_CHECK( eBUTTON_OK == button_deinit());
+
+    printf( "Virtual input test: %s\n", ( true == gb_is_ok ) ? "passed" : "FAILED" );
+
+    return ( true == gb_is_ok ) ? 0 : 1;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////